@@ -14,15 +14,44 @@
 ## See the License for the specific language governing permissions and
 ## limitations under the License.
 ##
+import json
 import os
 import sys
 import zlib
 
+# Only the sections and fields that ExtensionDB reads are embedded, the remainder of the
+# extension_api.json (sizes, offsets, native structures, singletons) is not needed at runtime.
+API_SECTIONS = ["builtin_classes", "global_enums", "utility_functions"]
+CLASS_FIELDS = ["name", "is_refcounted", "is_instantiable", "inherits", "api_type", "brief_description",
+                "description", "methods", "properties", "signals", "enums"]
+
+def compress(data):
+    buf = json.dumps(data, separators=(",", ":")).encode("utf-8")
+    return zlib.compress(buf, zlib.Z_BEST_COMPRESSION), len(buf)
+
+def write_byte_array(f, name, buf):
+    f.write(f"static const unsigned char {name}[] = {{\n")
+    for i in range(0, len(buf), 32):
+        f.write("\t" + ",".join(str(b) for b in buf[i:i + 32]) + ",\n")
+    f.write("};\n")
+    f.write("\n")
+
 def make_api_source(api_data, target):
-    buf = api_data.encode("utf-8")
-    decomp_size = len(buf)
+    api = json.loads(api_data)
+
+    core = { section: api.get(section, []) for section in API_SECTIONS }
+    core_buf, core_size = compress(core)
 
-    buf = zlib.compress(buf, zlib.Z_BEST_COMPRESSION)
+    # Classes are compressed individually and indexed by name, sorted by byte order so that the
+    # runtime can binary search the table and only decompress and parse the classes it is asked
+    # about, rather than materializing every engine class when the plugin loads.
+    classes = sorted(api.get("classes", []), key=lambda c: c["name"].encode("utf-8"))
+    class_entries = []
+    class_buf = bytearray()
+    for clazz in classes:
+        buf, size = compress({ key: clazz[key] for key in CLASS_FIELDS if key in clazz })
+        class_entries.append((clazz["name"], len(class_buf), len(buf), size))
+        class_buf += buf
 
     with open(target, 'w', encoding='utf-8') as f:
         f.write("""\
@@ -51,14 +80,20 @@ def make_api_source(api_data, target):
         f.write("\n")
         f.write("#include <godot_cpp/variant/packed_byte_array.hpp>\n")
         f.write("\n")
-        f.write(f"static const char* _api_data_hash = \"{hash(buf)}\";\n")
-        f.write(f"static const int _api_data_uncompressed_size = {decomp_size};\n")
-        f.write(f"static const int _api_data_compressed_size = {len(buf)};\n")
-        f.write("static const unsigned char _api_data_compressed[] = {\n")
-        for i in range(len(buf)):
-            f.write(f"\t{buf[i]},\n")
+        # Hashes the complete extension_api.json, so that any change to the engine API changes the hash
+        f.write(f"static const uint32_t _api_hash = {zlib.crc32(api_data.encode('utf-8'))}u;\n")
+        f.write(f"static const int _api_data_uncompressed_size = {core_size};\n")
+        f.write(f"static const int _api_data_compressed_size = {len(core_buf)};\n")
+        write_byte_array(f, "_api_data_compressed", core_buf)
+
+        f.write(f"static const int _api_class_count = {len(class_entries)};\n")
+        f.write("static const ExtensionClassEntry _api_classes[] = {\n")
+        for name, offset, compressed_size, size in class_entries:
+            f.write(f"\t{{ \"{name}\", {offset}, {compressed_size}, {size} }},\n")
         f.write("};\n")
         f.write("\n")
+        write_byte_array(f, "_api_classes_compressed", class_buf)
+
         f.write("void ExtensionDB::_decompress_and_load() {\n")
         f.write("\tPackedByteArray compressed;\n")
         f.write("\tcompressed.resize(_api_data_compressed_size);\n")
@@ -68,6 +103,23 @@ def make_api_source(api_data, target):
         f.write("\t_load(decompressed);\n")
         f.write("}\n")
         f.write("\n")
+        f.write("const ExtensionClassEntry* ExtensionDB::_get_class_entries(int& r_count) {\n")
+        f.write("\tr_count = _api_class_count;\n")
+        f.write("\treturn _api_classes;\n")
+        f.write("}\n")
+        f.write("\n")
+        f.write("uint32_t ExtensionDB::get_api_hash() {\n")
+        f.write("\treturn _api_hash;\n")
+        f.write("}\n")
+        f.write("\n")
+        f.write("PackedByteArray ExtensionDB::_decompress_class(const ExtensionClassEntry& p_entry) {\n")
+        f.write("\tPackedByteArray compressed;\n")
+        f.write("\tcompressed.resize(p_entry.compressed_size);\n")
+        f.write("\tmemcpy(compressed.ptrw(), _api_classes_compressed + p_entry.offset, p_entry.compressed_size);\n")
+        f.write("\n")
+        f.write("\treturn compressed.decompress(p_entry.uncompressed_size, 1);\n")
+        f.write("}\n")
+        f.write("\n")
 
 def main():
     if len(sys.argv) < 3:
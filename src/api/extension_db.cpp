@@ -21,6 +21,8 @@
 #include "core/godot/gdextension_compat.h"
 
 #include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/mutex_lock.hpp>
 #include <godot_cpp/classes/xml_parser.hpp>
 
 #define REGISTER_MATH_CONSTANT(m_name, m_type, m_value) {           \
@@ -265,7 +267,6 @@ void ExtensionDB::_load(const PackedByteArray& p_data) {
     _load_builtin_types(api_data);
     _load_global_enumerations(api_data);
     _load_utility_functions(api_data);
-    _load_classes(api_data);
 }
 
 void ExtensionDB::_load_docs(const PackedByteArray& p_data) {
@@ -504,89 +505,132 @@ void ExtensionDB::_load_utility_functions(const Dictionary& p_data) {
     }
 }
 
-void ExtensionDB::_load_classes(const Dictionary& p_data) {
-    const Array api_classes = p_data.get("classes", Array());
-    for (uint32_t i = 0; i < api_classes.size(); i++) {
-        const Dictionary& data = api_classes[i];
+void ExtensionDB::_load_class(const Dictionary& p_data, ClassInfo& r_class) {
+    r_class.name = p_data["name"];
+    r_class.ref_counted = p_data.get("is_refcounted", false);
+    r_class.instantiable = p_data.get("is_instantiable", false);
+    r_class.parent_class = p_data.get("inherits", "");
+    r_class.api_type = p_data.get("api_type", "");
+    r_class.brief_description = p_data.get("brief_description", "");
+    r_class.description = p_data.get("description", "");
+
+    const Array methods = p_data.get("methods", Array());
+    for (uint32_t j = 0; j < methods.size(); j++) {
+        const Dictionary& method_data = methods[j];
+
+        ClassMethodInfo cmi;
+        cmi.method.name = method_data["name"];
+        cmi.method.flags = _resolve_method_flags(method_data);
+        cmi.method.return_val = _resolve_method_return(method_data);
+        cmi.hash = method_data["hash"];
+        cmi.description = method_data.get("description", "");
+
+        const Array args = method_data.get("arguments", Array());
+        for (uint32_t k = 0; k < args.size(); k++) {
+            const Dictionary& arg_data = args[k];
+            cmi.method.arguments.push_back(_resolve_method_argument(arg_data));
+            if (arg_data.has("default_value")) {
+                cmi.method.default_arguments.push_back(_resolve_method_argument_default(arg_data));
+            }
+        }
 
-        ClassInfo ci;
-        ci.name = data["name"];
-        ci.ref_counted = data.get("is_refcounted", false);
-        ci.instantiable = data.get("is_instantiable", false);
-        ci.parent_class = data.get("inherits", "");
-        ci.api_type = data.get("api_type", "");
-        ci.brief_description = data.get("brief_description", "");
-        ci.description = data.get("description", "");
+        r_class.methods[cmi.method.name] = cmi;
+    }
 
-        const Array methods = data.get("methods", Array());
-        for (uint32_t j = 0; j < methods.size(); j++) {
-            const Dictionary& method_data = methods[j];
+    const Array properties = p_data.get("properties", Array());
+    for (uint32_t j = 0; j < properties.size(); j++) {
+        const Dictionary& prop_data = properties[j];
 
-            ClassMethodInfo cmi;
-            cmi.method.name = method_data["name"];
-            cmi.method.flags = _resolve_method_flags(method_data);
-            cmi.method.return_val = _resolve_method_return(method_data);
-            cmi.hash = method_data["hash"];
-            cmi.description = method_data.get("description", "");
+        ClassPropertyInfo cpi;
+        cpi.property = _resolve_method_argument(prop_data);
+        cpi.getter = prop_data.get("getter", "");
+        cpi.setter = prop_data.get("setter", "");
+        cpi.description = prop_data.get("description", "");
 
-            const Array args = method_data.get("arguments", Array());
-            for (uint32_t k = 0; k < args.size(); k++) {
-                const Dictionary& arg_data = args[k];
-                cmi.method.arguments.push_back(_resolve_method_argument(arg_data));
-                if (arg_data.has("default_value")) {
-                    cmi.method.default_arguments.push_back(_resolve_method_argument_default(arg_data));
-                }
-            }
+        r_class.properties[cpi.property.name] = cpi;
+    }
 
-            ci.methods[cmi.method.name] = cmi;
-        }
+    const Array signals = p_data.get("signals", Array());
+    for (uint32_t j = 0; j < signals.size(); j++) {
+        const Dictionary& signal_data = signals[j];
 
-        const Array properties = data.get("properties", Array());
-        for (uint32_t j = 0; j < properties.size(); j++) {
-            const Dictionary& prop_data = properties[j];
+        ClassSignalInfo csi;
+        csi.method.name = signal_data["name"];
+        csi.description = signal_data.get("description", "");
+        const Array args = signal_data.get("arguments", Array());
+        for (uint32_t k = 0; k < args.size(); k++) {
+            const Dictionary& arg_data = args[k];
+            csi.method.arguments.push_back(_resolve_method_argument(arg_data));
+        }
 
-            ClassPropertyInfo cpi;
-            cpi.property = _resolve_method_argument(prop_data);
-            cpi.getter = prop_data.get("getter", "");
-            cpi.setter = prop_data.get("setter", "");
-            cpi.description = prop_data.get("description", "");
+        r_class.signals[csi.method.name] = csi;
+    }
 
-            ci.properties[cpi.property.name] = cpi;
+    const Array class_enums = p_data.get("enums", Array());
+    for (uint32_t j = 0; j < class_enums.size(); j++) {
+        const Dictionary& enum_data = class_enums[j];
+        if (enum_data.get("is_bitfield", false)) {
+            r_class.bitfield_enums.push_back(enum_data["name"]);
         }
+    }
+}
 
-        const Array signals = data.get("signals", Array());
-        for (uint32_t j = 0; j < signals.size(); j++) {
-            const Dictionary& signal_data = signals[j];
+const ExtensionClassEntry* ExtensionDB::_find_class_entry(const StringName& p_class_name) {
+    const CharString name = String(p_class_name).utf8();
 
-            ClassSignalInfo csi;
-            csi.method.name = signal_data["name"];
-            csi.description = signal_data.get("description", "");
-            const Array args = signal_data.get("arguments", Array());
-            for (uint32_t k = 0; k < args.size(); k++) {
-                const Dictionary& arg_data = args[k];
-                csi.method.arguments.push_back(_resolve_method_argument(arg_data));
-            }
+    int count = 0;
+    const ExtensionClassEntry* entries = _get_class_entries(count);
 
-            ci.signals[csi.method.name] = csi;
+    // The generated table is sorted by the byte order of the class names
+    int low = 0;
+    int high = count - 1;
+    while (low <= high) {
+        const int mid = low + (high - low) / 2;
+        const int result = strcmp(entries[mid].name, name.get_data());
+        if (result == 0) {
+            return &entries[mid];
         }
-
-        const Array class_enums = data.get("enums", Array());
-        for (uint32_t j = 0; j < class_enums.size(); j++) {
-            const Dictionary& enum_data = class_enums[j];
-            if (enum_data.get("is_bitfield", false)) {
-                ci.bitfield_enums.push_back(enum_data["name"]);
-            }
+        if (result < 0) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
         }
+    }
 
-        classes[ci.name] = ci;
+    return nullptr;
+}
+
+const ClassInfo* ExtensionDB::_get_class(const StringName& p_class_name) {
+    if (p_class_name.is_empty()) {
+        return nullptr;
     }
 
-    // Iterate classes and link inheritance pointers
-    for (KeyValue<StringName, ClassInfo>& E : classes) {
-        if (!E.value.parent_class.is_empty()) {
-            E.value.parent = classes.getptr(E.value.parent_class);
-        }
+    MutexLock lock(*_classes_lock.ptr());
+    return _materialize_class(p_class_name);
+}
+
+ClassInfo* ExtensionDB::_materialize_class(const StringName& p_class_name) {
+    if (ClassInfo* existing = classes.getptr(p_class_name)) {
+        return existing;
+    }
+
+    const ExtensionClassEntry* entry = _find_class_entry(p_class_name);
+    if (!entry) {
+        return nullptr;
     }
+
+    const Dictionary data = JSON::parse_string(_decompress_class(*entry).get_string_from_utf8());
+    ERR_FAIL_COND_V_MSG(data.is_empty(), nullptr, "Failed to load Orchestrator API data for class " + p_class_name);
+
+    ClassInfo& clazz = classes[p_class_name];
+    _load_class(data, clazz);
+
+    // Parents are materialized with their first child, so inheritance chains can be walked freely
+    if (!clazz.parent_class.is_empty()) {
+        clazz.parent = _materialize_class(clazz.parent_class);
+    }
+
+    return &clazz;
 }
 
 const HashSet<StringName>& ExtensionDB::_get_native_property_names(const StringName& p_class_name) {
@@ -693,14 +737,14 @@ FunctionInfo ExtensionDB::get_utility_function(const StringName& p_name) {
 }
 
 bool ExtensionDB::is_class_enum_bitfield(const StringName& p_class_name, const StringName& p_enum_name) {
-    if (_singleton->classes.has(p_class_name)) {
-        return _singleton->classes[p_class_name].bitfield_enums.has(p_enum_name);
+    if (const ClassInfo* clazz = _singleton->_get_class(p_class_name)) {
+        return clazz->bitfield_enums.has(p_enum_name);
     }
     return false;
 }
 
 PackedStringArray ExtensionDB::get_class_static_function_names(const StringName& p_class_name) {
-    const ClassInfo* clazz = _singleton->classes.getptr(p_class_name);
+    const ClassInfo* clazz = _singleton->_get_class(p_class_name);
     if (!clazz) {
         return {};
     }
@@ -715,7 +759,7 @@ PackedStringArray ExtensionDB::get_class_static_function_names(const StringName&
 }
 
 bool ExtensionDB::get_class_method_info(const StringName& p_class_name, const StringName& p_method_name, MethodInfo& r_info, bool p_no_inheritance) {
-    const ClassInfo* clazz = _singleton->classes.getptr(p_class_name);
+    const ClassInfo* clazz = _singleton->_get_class(p_class_name);
     while (clazz) {
         const ClassMethodInfo* method = clazz->methods.getptr(p_method_name);
         if (method) {
@@ -746,7 +790,7 @@ bool ExtensionDB::get_class_method_info(const StringName& p_class_name, const St
 }
 
 MethodBind* ExtensionDB::get_method(const StringName& p_class_name, const StringName& p_method_name, MethodInfo* r_info) {
-    const ClassInfo* clazz = _singleton->classes.getptr(p_class_name);
+    const ClassInfo* clazz = _singleton->_get_class(p_class_name);
     while (clazz) {
         const ClassMethodInfo* method = clazz->methods.getptr(p_method_name);
         if (method) {
@@ -790,10 +834,16 @@ bool ExtensionDB::is_shadowing_class_member(const StringName& p_class_name, cons
 }
 
 ExtensionDB::ExtensionDB() {
+    _classes_lock.instantiate();
+
+    const uint64_t start_time = Time::get_singleton()->get_ticks_usec();
+
     _decompress_and_load();
     #ifdef TOOLS_ENABLED
     _decompress_and_load_docs();
     #endif
+
+    print_verbose(vformat("Orchestrator: Loaded API data in %d usec.", Time::get_singleton()->get_ticks_usec() - start_time));
 }
 
 ExtensionDB::~ExtensionDB() {
@@ -18,6 +18,7 @@
 
 #include "common/variant_operators.h"
 
+#include <godot_cpp/classes/mutex.hpp>
 #include <godot_cpp/classes/xml_parser.hpp>
 #include <godot_cpp/core/method_bind.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
@@ -119,6 +120,14 @@ namespace godot {
             ClassInfo* parent = nullptr;
         };
 
+        /// An entry in the generated, name-sorted class table
+        struct ExtensionClassEntry {
+            const char* name;
+            uint32_t offset;
+            uint32_t compressed_size;
+            uint32_t uncompressed_size;
+        };
+
     class ExtensionDB {
         static ExtensionDB* _singleton;
 
@@ -138,7 +147,10 @@ namespace godot {
 
         HashMap<StringName, FunctionInfo> utility_functions;
 
+        // Classes are materialized from the generated class table on first lookup, see _get_class.
+        // Elements are never removed, so pointers handed out remain valid for the database lifetime.
         HashMap<StringName, ClassInfo> classes;
+        Ref<Mutex> _classes_lock;
         HashMap<String, String> setting_descriptions;
 
         // Lazily-built, per-class (own, no-inheritance) native property names, sourced from live
@@ -171,7 +183,14 @@ namespace godot {
         void _load_builtin_types(const Dictionary& p_data);
         void _load_global_enumerations(const Dictionary& p_data);
         void _load_utility_functions(const Dictionary& p_data);
-        void _load_classes(const Dictionary& p_data);
+        void _load_class(const Dictionary& p_data, ClassInfo& r_class);
+
+        static const ExtensionClassEntry* _get_class_entries(int& r_count); // NOLINT - generated dynamically
+        static PackedByteArray _decompress_class(const ExtensionClassEntry& p_entry); // NOLINT - generated dynamically
+        static const ExtensionClassEntry* _find_class_entry(const StringName& p_class_name);
+
+        const ClassInfo* _get_class(const StringName& p_class_name);
+        ClassInfo* _materialize_class(const StringName& p_class_name);
 
         const HashSet<StringName>& _get_native_property_names(const StringName& p_class_name);
 
@@ -179,6 +198,9 @@ namespace godot {
         static void create();
         static void destroy();
 
+        // Hash of the engine's extension API data the plugin was built against
+        static uint32_t get_api_hash(); // NOLINT - generated dynamically
+
         // Built-in Types
         static bool is_builtin_type(const StringName& p_type_name);
         static Vector<BuiltInType> get_builtin_types();
@@ -309,6 +309,7 @@ void OrchestratorSettings::_initialize_settings() {
     GLOBAL_DEF_BASIC(PropertyInfo(Variant::BOOL, "debug/settings/always_track_call_stacks"), false);
     GLOBAL_DEF_BASIC(PropertyInfo(Variant::BOOL, "debug/settings/always_track_local_variables"), false);
     GLOBAL_DEF_BASIC(PropertyInfo(Variant::BOOL, "debug/settings/use_node_convergence"), true);
+    GLOBAL_DEF_BASIC(PropertyInfo(Variant::BOOL, "debug/settings/optimize_bytecode"), false);
 
     #ifdef DEBUG_ENABLED
     GLOBAL_DEF_BASIC(PropertyInfo(Variant::BOOL, "debug/warnings/enable"), true);
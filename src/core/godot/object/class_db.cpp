@@ -20,13 +20,182 @@
 #include "common/dictionary_utils.h"
 #include "script/script_server.h"
 
+#include <godot_cpp/classes/gd_extension_manager.hpp>
+#include <godot_cpp/classes/mutex.hpp>
 #include <godot_cpp/classes/resource.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/mutex_lock.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
 
 using namespace godot;
 using GClassDB = godot::ClassDB;
 
+namespace {
+    /// Metadata declared directly by a single native class, excluding anything inherited.
+    struct ClassIndex {
+        struct PropertyEntry {
+            StringName setter;
+            StringName getter;
+        };
+
+        StringName parent;
+        HashMap<StringName, PropertyEntry> properties;
+        HashMap<StringName, MethodInfo> signals;
+        HashMap<StringName, int64_t> constants;
+        HashSet<StringName> enums;
+
+        explicit ClassIndex(const StringName& p_class_name);
+    };
+
+    ClassIndex::ClassIndex(const StringName& p_class_name) {
+        // Unknown classes, i.e. global script classes, resolve to an empty index.
+        if (!GClassDB::class_exists(p_class_name)) {
+            return;
+        }
+
+        parent = GClassDB::get_parent_class(p_class_name);
+
+        const TypedArray<Dictionary> property_list = GClassDB::class_get_property_list(p_class_name, true);
+        for (uint32_t i = 0; i < property_list.size(); i++) {
+            const Dictionary& dict = property_list[i];
+            const StringName name = dict.get("name", "");
+
+            PropertyEntry& entry = properties[name];
+
+            // Groups and categories have no accessors
+            const int64_t usage = dict.get("usage", 0);
+            if (usage & (PROPERTY_USAGE_CATEGORY | PROPERTY_USAGE_GROUP | PROPERTY_USAGE_SUBGROUP)) {
+                continue;
+            }
+
+            entry.setter = GClassDB::class_get_property_setter(p_class_name, name);
+            entry.getter = GClassDB::class_get_property_getter(p_class_name, name);
+        }
+
+        const TypedArray<Dictionary> signal_list = GClassDB::class_get_signal_list(p_class_name, true);
+        for (uint32_t i = 0; i < signal_list.size(); i++) {
+            const MethodInfo signal = DictionaryUtils::to_method(signal_list[i]);
+            signals[signal.name] = signal;
+        }
+
+        const PackedStringArray constant_list = GClassDB::class_get_integer_constant_list(p_class_name, true);
+        for (const String& constant_name : constant_list) {
+            constants[constant_name] = GClassDB::class_get_integer_constant(p_class_name, constant_name);
+        }
+
+        const PackedStringArray enum_list = GClassDB::class_get_enum_list(p_class_name, true);
+        for (const String& enum_name : enum_list) {
+            enums.insert(enum_name);
+        }
+    }
+
+    struct ClassIndexCache {
+        Ref<Mutex> mutex;
+        HashMap<StringName, ClassIndex*> classes;
+
+        void clear() {
+            for (const KeyValue<StringName, ClassIndex*>& E : classes) {
+                memdelete(E.value);
+            }
+            classes.clear();
+        }
+
+        ~ClassIndexCache() { clear(); }
+    };
+
+    ClassIndexCache* class_index_cache = nullptr;
+
+    /// Get the index of the given class, building it on first use.
+    /// The cache mutex must be held, and the returned index is only valid while it is held.
+    const ClassIndex* get_class_index(const StringName& p_class_name) {
+        if (ClassIndex** index = class_index_cache->classes.getptr(p_class_name)) {
+            return *index;
+        }
+
+        ClassIndex* index = memnew(ClassIndex(p_class_name));
+        class_index_cache->classes[p_class_name] = index;
+        return index;
+    }
+
+    /// Walks the class and optionally its ancestors, returning the first non-null lookup result.
+    template <typename T, typename F>
+    const T* find_in_hierarchy(const StringName& p_class_name, bool p_no_inheritance, F p_lookup) {
+        StringName class_name = p_class_name;
+        while (!class_name.is_empty()) {
+            const ClassIndex* index = get_class_index(class_name);
+            if (const T* result = p_lookup(index)) {
+                return result;
+            }
+            if (p_no_inheritance) {
+                break;
+            }
+            class_name = index->parent;
+        }
+        return nullptr;
+    }
+
+    const ClassIndex::PropertyEntry* find_property(const StringName& p_class_name, const StringName& p_property_name, bool p_no_inheritance) {
+        return find_in_hierarchy<ClassIndex::PropertyEntry>(p_class_name, p_no_inheritance, [&](const ClassIndex* p_index) {
+            return p_index->properties.getptr(p_property_name);
+        });
+    }
+
+    const MethodInfo* find_signal(const StringName& p_class_name, const StringName& p_signal_name, bool p_no_inheritance) {
+        return find_in_hierarchy<MethodInfo>(p_class_name, p_no_inheritance, [&](const ClassIndex* p_index) {
+            return p_index->signals.getptr(p_signal_name);
+        });
+    }
+
+    const int64_t* find_constant(const StringName& p_class_name, const StringName& p_constant_name, bool p_no_inheritance) {
+        return find_in_hierarchy<int64_t>(p_class_name, p_no_inheritance, [&](const ClassIndex* p_index) {
+            return p_index->constants.getptr(p_constant_name);
+        });
+    }
+
+    bool find_enum(const StringName& p_class_name, const StringName& p_enum_name, bool p_no_inheritance) {
+        return find_in_hierarchy<ClassIndex>(p_class_name, p_no_inheritance, [&](const ClassIndex* p_index) {
+            return p_index->enums.has(p_enum_name) ? p_index : nullptr;
+        }) != nullptr;
+    }
+}
+
+void GDE::ClassDB::create_cache() {
+    ERR_FAIL_COND_MSG(class_index_cache, "Class index cache already created");
+
+    class_index_cache = memnew(ClassIndexCache);
+    class_index_cache->mutex.instantiate();
+
+    // Extensions can register, unregister, or replace native classes at any time
+    GDExtensionManager* manager = GDExtensionManager::get_singleton();
+    manager->connect("extension_loaded", callable_mp_static(&GDE::ClassDB::clear_cache).unbind(1));
+    manager->connect("extension_unloading", callable_mp_static(&GDE::ClassDB::clear_cache).unbind(1));
+    manager->connect("extensions_reloaded", callable_mp_static(&GDE::ClassDB::clear_cache));
+}
+
+void GDE::ClassDB::free_cache() {
+    if (!class_index_cache) {
+        return;
+    }
+
+    GDExtensionManager* manager = GDExtensionManager::get_singleton();
+    if (manager) {
+        manager->disconnect("extension_loaded", callable_mp_static(&GDE::ClassDB::clear_cache).unbind(1));
+        manager->disconnect("extension_unloading", callable_mp_static(&GDE::ClassDB::clear_cache).unbind(1));
+        manager->disconnect("extensions_reloaded", callable_mp_static(&GDE::ClassDB::clear_cache));
+    }
+
+    memdelete(class_index_cache);
+    class_index_cache = nullptr;
+}
+
+void GDE::ClassDB::clear_cache() {
+    if (class_index_cache) {
+        MutexLock lock(*class_index_cache->mutex.ptr());
+        class_index_cache->clear();
+    }
+}
+
 bool GDE::ClassDB::can_instantiate(const godot::StringName& p_class_name) {
     // This intentionally mirrors the Godot ClassDB call to pre-condition when a bad class name
     // is supplied to avoid an output error message.
@@ -58,15 +227,20 @@ StringName GDE::ClassDB::get_parent_class_nocheck(const StringName& p_class_name
 }
 
 bool GDE::ClassDB::has_enum(const StringName& p_class_name, const String& p_enum_name, bool p_no_inheritance) {
-    return GClassDB::class_get_enum_list(p_class_name, p_no_inheritance).has(p_enum_name);
+    ERR_FAIL_NULL_V(class_index_cache, false);
+    MutexLock lock(*class_index_cache->mutex.ptr());
+    return find_enum(p_class_name, p_enum_name, p_no_inheritance);
 }
 
 int64_t GDE::ClassDB::get_integer_constant(const StringName& p_class_name, const String& p_constant_name, bool& r_valid) {
-    if (GClassDB::class_has_integer_constant(p_class_name, p_constant_name)) {
+    r_valid = false;
+    ERR_FAIL_NULL_V(class_index_cache, 0);
+
+    MutexLock lock(*class_index_cache->mutex.ptr());
+    if (const int64_t* value = find_constant(p_class_name, p_constant_name, false)) {
         r_valid = true;
-        return GClassDB::class_get_integer_constant(p_class_name, p_constant_name);
+        return *value;
     }
-    r_valid = false;
     return 0;
 }
 
@@ -78,7 +252,9 @@ StringName GDE::ClassDB::get_integer_constant_enum(const StringName& p_class_nam
 }
 
 bool GDE::ClassDB::has_integer_constant(const StringName& p_class_name, const String& p_constant_name, bool p_no_inheritance) {
-    return GClassDB::class_get_integer_constant_list(p_class_name, p_no_inheritance).has(p_constant_name);
+    ERR_FAIL_NULL_V(class_index_cache, false);
+    MutexLock lock(*class_index_cache->mutex.ptr());
+    return find_constant(p_class_name, p_constant_name, p_no_inheritance) != nullptr;
 }
 
 bool GDE::ClassDB::get_method_info(const StringName& p_class_name, const StringName& p_method_name, MethodInfo& r_info, bool p_no_inheritance, bool p_exclude_from_properties) {
@@ -86,22 +262,23 @@ bool GDE::ClassDB::get_method_info(const StringName& p_class_name, const StringN
 }
 
 bool GDE::ClassDB::has_property(const StringName& p_class_name, const StringName& p_property_name, bool p_no_inheritance) {
-    const TypedArray<Dictionary> properties = GClassDB::class_get_property_list(p_class_name, p_no_inheritance);
-    for (uint32_t i = 0; i < properties.size(); i++) {
-        const Dictionary& dict = properties[i];
-        if (StringName(dict.get("name", "")) == p_property_name) {
-            return true;
-        }
-    }
-    return false;
+    ERR_FAIL_NULL_V(class_index_cache, false);
+    MutexLock lock(*class_index_cache->mutex.ptr());
+    return find_property(p_class_name, p_property_name, p_no_inheritance) != nullptr;
 }
 
 StringName GDE::ClassDB::get_property_setter(const StringName& p_class_name, const StringName& p_property_name) {
-    return GClassDB::class_get_property_setter(p_class_name, p_property_name);
+    ERR_FAIL_NULL_V(class_index_cache, {});
+    MutexLock lock(*class_index_cache->mutex.ptr());
+    const ClassIndex::PropertyEntry* entry = find_property(p_class_name, p_property_name, false);
+    return entry ? entry->setter : StringName();
 }
 
 StringName GDE::ClassDB::get_property_getter(const StringName& p_class_name, const StringName& p_property_name) {
-    return GClassDB::class_get_property_getter(p_class_name, p_property_name);
+    ERR_FAIL_NULL_V(class_index_cache, {});
+    MutexLock lock(*class_index_cache->mutex.ptr());
+    const ClassIndex::PropertyEntry* entry = find_property(p_class_name, p_property_name, false);
+    return entry ? entry->getter : StringName();
 }
 
 Variant GDE::ClassDB::get_property_default_value(const StringName& p_class_name, const StringName& p_property_name) {
@@ -110,21 +287,17 @@ Variant GDE::ClassDB::get_property_default_value(const StringName& p_class_name,
 }
 
 bool GDE::ClassDB::has_signal(const StringName& p_class_name, const StringName& p_signal_name, bool p_no_inheritance) {
-    const TypedArray<Dictionary> signals = GClassDB::class_get_signal_list(p_class_name, p_no_inheritance);
-    for (uint32_t i = 0; i < signals.size(); i++) {
-        const Dictionary& dict = signals[i];
-        if (StringName(dict.get("name", "")) == p_signal_name) {
-            return true;
-        }
-    }
-    return false;
+    ERR_FAIL_NULL_V(class_index_cache, false);
+    MutexLock lock(*class_index_cache->mutex.ptr());
+    return find_signal(p_class_name, p_signal_name, p_no_inheritance) != nullptr;
 }
 
 bool GDE::ClassDB::get_signal(const StringName& p_class_name, const StringName& p_signal_name, MethodInfo& r_info) {
-    if (GClassDB::class_has_signal(p_class_name, p_signal_name)) {
-        const Dictionary signal = GClassDB::class_get_signal(p_class_name, p_signal_name);
-        r_info = DictionaryUtils::to_method(signal);
+    ERR_FAIL_NULL_V(class_index_cache, false);
+    MutexLock lock(*class_index_cache->mutex.ptr());
+    if (const MethodInfo* signal = find_signal(p_class_name, p_signal_name, false)) {
+        r_info = *signal;
         return true;
     }
     return false;
-}
\ No newline at end of file
+}
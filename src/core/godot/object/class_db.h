@@ -20,9 +20,24 @@
 
 namespace GDE {
 
+    /// Native class metadata queries.
+    ///
+    /// Property, signal, constant and enum lookups are served from a per-class index that is built
+    /// lazily on first use and shared by every caller, including analyzers running on worker threads.
+    /// The index must be dropped with <code>clear_cache</code> whenever the set of native classes or
+    /// global classes changes.
     struct ClassDB {
         ClassDB() = delete;
 
+        /// Creates the shared class index and connects to extension lifecycle signals.
+        static void create_cache();
+
+        /// Disconnects from extension lifecycle signals and releases the shared class index.
+        static void free_cache();
+
+        /// Drops all indexed class metadata, which is rebuilt lazily on the next lookup.
+        static void clear_cache();
+
         static bool can_instantiate(const godot::StringName& p_class_name);
         static bool is_abstract(const godot::StringName& p_class_name);
         static bool is_class_exposed(const godot::StringName& p_class_name);
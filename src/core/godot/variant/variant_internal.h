@@ -20,6 +20,8 @@
 
 #include <godot_cpp/variant/variant.hpp>
 
+#include <cstring>
+
 namespace GDE {
     struct VariantInternal {
         VariantInternal() = delete;
@@ -34,5 +36,61 @@ namespace GDE {
                 0,
                 &error);
         }
+
+        /// Checks whether a <code>Variant</code> of the given type owns data that must be destroyed
+        _FORCE_INLINE_ static bool needs_deinit(godot::Variant::Type p_type) {
+            switch (p_type) {
+                case godot::Variant::NIL:
+                case godot::Variant::BOOL:
+                case godot::Variant::INT:
+                case godot::Variant::FLOAT:
+                case godot::Variant::VECTOR2:
+                case godot::Variant::VECTOR2I:
+                case godot::Variant::RECT2:
+                case godot::Variant::RECT2I:
+                case godot::Variant::VECTOR3:
+                case godot::Variant::VECTOR3I:
+                case godot::Variant::VECTOR4:
+                case godot::Variant::VECTOR4I:
+                case godot::Variant::PLANE:
+                case godot::Variant::QUATERNION:
+                case godot::Variant::COLOR:
+                case godot::Variant::RID:
+                    return false;
+                default:
+                    return true;
+            }
+        }
+
+        /// Destroys the current value and constructs a default <code>Variant</code> of the given type in-place
+        _FORCE_INLINE_ static void reinitialize(godot::Variant* p_value, godot::Variant::Type p_type) {
+            if (needs_deinit(p_value->get_type())) {
+                GDE_INTERFACE(variant_destroy)(p_value);
+            }
+            initialize(p_value, p_type);
+        }
+
+        /// Evaluates an operator and stores the result directly in the destination without an intermediate
+        /// <code>Variant</code>. The destination may alias either operand.
+        _FORCE_INLINE_ static void evaluate(godot::Variant::Operator p_operator, const godot::Variant* p_left,
+                                            const godot::Variant* p_right, godot::Variant* r_dst, bool& r_valid) {
+            // The engine constructs the result into uninitialized memory, so evaluate into raw storage
+            // and relocate it once the operands have been read.
+            alignas(godot::Variant) uint8_t result[sizeof(godot::Variant)];
+
+            GDExtensionBool valid;
+            GDE_INTERFACE(variant_evaluate)(
+                static_cast<GDExtensionVariantOperator>(p_operator),
+                p_left,
+                p_right,
+                result,
+                &valid);
+
+            if (needs_deinit(r_dst->get_type())) {
+                GDE_INTERFACE(variant_destroy)(r_dst);
+            }
+            memcpy(static_cast<void*>(r_dst), result, sizeof(godot::Variant));
+            r_valid = valid;
+        }
     };
 }
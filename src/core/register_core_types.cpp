@@ -18,6 +18,7 @@
 
 #include "common/settings.h"
 #include "core/godot/core_string_names.h"
+#include "core/godot/object/class_db.h"
 #include "core/godot/scene_string_names.h"
 #include "godot/config/project_settings_cache.h"
 
@@ -36,6 +37,8 @@ void create_core_singletons() {
     CoreStringNames::create();
     SceneStringNames::create();
 
+    GDE::ClassDB::create_cache();
+
     OrchestratorSettings::create();
     OrchestratorProjectSettingsCache::create();
 }
@@ -44,6 +47,8 @@ void destroy_core_singletons() {
     OrchestratorProjectSettingsCache::destroy();
     OrchestratorSettings::destroy();
 
+    GDE::ClassDB::free_cache();
+
     SceneStringNames::free();
     CoreStringNames::free();
 }
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include "common/callable_lambda.h"
 #include "common/macros.h"
 #include "core/godot/config/project_settings_cache.h"
+#include "core/godot/object/class_db.h"
 #include "editor/actions/introspector.h"
 #include "orchestration/nodes/arrays.h"
 #include "script/script_server.h"
@@ -166,6 +167,8 @@ OrchestratorEditorActionRegistry::OrchestratorEditorActionRegistry()
     _rebuild_base_actions();
 
     EI->get_resource_filesystem()->connect("script_classes_updated", callable_mp_lambda(this, [&] {
+        GDE::ClassDB::clear_cache();
+
         // In the event this signal is called multiple times by the file system in quick succession,
         // the plugin uses a timer to debounce the calls so that only one rebuild fires.
         _global_script_class_update_timer->start();
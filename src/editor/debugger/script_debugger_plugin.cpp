@@ -20,9 +20,17 @@
 
 OrchestratorEditorDebuggerPlugin* OrchestratorEditorDebuggerPlugin::_singleton = nullptr;
 
+void OrchestratorEditorDebuggerPlugin::_clear_node_profiles() {
+    if (!_node_profiles.is_empty()) {
+        _node_profiles.clear();
+        emit_signal("node_profiles_updated");
+    }
+}
+
 void OrchestratorEditorDebuggerPlugin::_session_started(int32_t p_session_id) {
     // Session id is 0, when game starts.
     _session_active = true;
+    _clear_node_profiles();
 }
 
 void OrchestratorEditorDebuggerPlugin::_session_stopped(int32_t p_session_id) {
@@ -55,19 +63,48 @@ void OrchestratorEditorDebuggerPlugin::_goto_script_line(const Ref<Script>& p_sc
     emit_signal("goto_script_line", p_script, p_line + 1);
 }
 
+void OrchestratorEditorDebuggerPlugin::_queue_breakpoints_changed() {
+    // Deferred so the notification follows the engine's own breakpoint messages, which the engine may
+    // only send after this plugin is told about the change, and so that bulk changes send one message.
+    if (!_breakpoints_changed_queued) {
+        _breakpoints_changed_queued = true;
+        callable_mp_this(_notify_breakpoints_changed).call_deferred();
+    }
+}
+
+void OrchestratorEditorDebuggerPlugin::_notify_breakpoints_changed() {
+    // Every running game re-checks its cached breakpoints
+    _breakpoints_changed_queued = false;
+
+    const TypedArray<EditorDebuggerSession> sessions = get_sessions();
+    for (int i = 0; i < sessions.size(); i++) {
+        const Ref<EditorDebuggerSession> session = sessions[i];
+        if (session.is_valid() && session->is_active()) {
+            session->send_message("orchestrator:breakpoints_changed", Array());
+        }
+    }
+}
+
 void OrchestratorEditorDebuggerPlugin::_breakpoints_cleared_in_tree() {
     emit_signal("breakpoints_cleared_in_tree");
+    _queue_breakpoints_changed();
 }
 
 void OrchestratorEditorDebuggerPlugin::_breakpoint_set_in_tree(const Ref<Script>& p_script, int p_line, bool p_enabled) {
     emit_signal("breakpoint_set_in_tree", p_script, p_line + 1, p_enabled);
+    _queue_breakpoints_changed();
 }
 
 void OrchestratorEditorDebuggerPlugin::set_breakpoint(const String& p_file, int32_t p_line, bool p_enabled) {
-    if (!_current_session.is_valid()) {
-        return;
+    // Breakpoints apply to every running game, as the engine does with its own breakpoints
+    const TypedArray<EditorDebuggerSession> sessions = get_sessions();
+    for (int i = 0; i < sessions.size(); i++) {
+        const Ref<EditorDebuggerSession> session = sessions[i];
+        if (session.is_valid()) {
+            session->set_breakpoint(p_file, p_line, p_enabled);
+        }
     }
-    _current_session->set_breakpoint(p_file, p_line, p_enabled);
+    _queue_breakpoints_changed();
 }
 
 void OrchestratorEditorDebuggerPlugin::reload_all_scripts() {
@@ -90,6 +127,34 @@ void OrchestratorEditorDebuggerPlugin::reload_scripts(const Vector<String>& p_sc
     _current_session->send_message("reload_scripts", scripts);
 }
 
+bool OrchestratorEditorDebuggerPlugin::_has_capture(const String& p_capture) const {
+    return p_capture == "orchestrator";
+}
+
+bool OrchestratorEditorDebuggerPlugin::_capture(const String& p_message, const Array& p_data, int32_t p_session_id) {
+    if (p_message == "orchestrator:node_profiles") {
+        // Each message carries the totals since the profiler started, as pairs of a script path and
+        // flat (node id, hit count, total time) triples.
+        _node_profiles.clear();
+        for (int i = 0; i + 1 < p_data.size(); i += 2) {
+            const PackedInt64Array nodes = p_data[i + 1];
+            NodeProfileMap& profiles = _node_profiles[p_data[i]];
+            for (int j = 0; j + 2 < nodes.size(); j += 3) {
+                NodeProfile& profile = profiles[int(nodes[j])];
+                profile.hit_count = nodes[j + 1];
+                profile.total_time = nodes[j + 2];
+            }
+        }
+        emit_signal("node_profiles_updated");
+        return true;
+    }
+    return false;
+}
+
+const OrchestratorEditorDebuggerPlugin::NodeProfileMap* OrchestratorEditorDebuggerPlugin::get_node_profiles(const String& p_path) const {
+    return _node_profiles.getptr(p_path);
+}
+
 bool OrchestratorEditorDebuggerPlugin::is_active() const {
     return _session_active;
 }
@@ -128,6 +193,7 @@ void OrchestratorEditorDebuggerPlugin::_bind_methods() {
     ADD_SIGNAL(MethodInfo("goto_script_line", PropertyInfo(Variant::OBJECT, "script"), PropertyInfo(Variant::INT, "line")));
     ADD_SIGNAL(MethodInfo("breakpoints_cleared_in_tree"));
     ADD_SIGNAL(MethodInfo("breakpoint_set_in_tree", PropertyInfo(Variant::OBJECT, "script"), PropertyInfo(Variant::INT, "line"), PropertyInfo(Variant::BOOL, "enabled")));
+    ADD_SIGNAL(MethodInfo("node_profiles_updated"));
 }
 
 OrchestratorEditorDebuggerPlugin::OrchestratorEditorDebuggerPlugin() {
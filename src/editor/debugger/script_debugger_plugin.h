@@ -27,9 +27,25 @@ using namespace godot;
 class OrchestratorEditorDebuggerPlugin : public EditorDebuggerPlugin {
     GDCLASS(OrchestratorEditorDebuggerPlugin, EditorDebuggerPlugin);
 
+public:
+    /// Execution totals of a single script node, reported while the profiler runs
+    struct NodeProfile {
+        uint64_t hit_count = 0;
+        uint64_t total_time = 0;
+    };
+
+    typedef HashMap<int, NodeProfile> NodeProfileMap;
+
+private:
     static OrchestratorEditorDebuggerPlugin* _singleton;  //! Singleton instance
     Ref<EditorDebuggerSession> _current_session;          //! Current debugger session
     bool _session_active = false;                         //! Whether session is active
+    HashMap<String, NodeProfileMap> _node_profiles;       //! Node profiles by script path
+    bool _breakpoints_changed_queued = false;             //! Whether a breakpoint change notification is queued
+
+    void _clear_node_profiles();
+    void _queue_breakpoints_changed();
+    void _notify_breakpoints_changed();
 
 protected:
     static void _bind_methods();
@@ -47,6 +63,8 @@ public:
     void _goto_script_line(const Ref<Script>& p_script, int p_line) override;
     void _breakpoints_cleared_in_tree() override;
     void _breakpoint_set_in_tree(const Ref<Script>& p_script, int p_line, bool p_enabled) override;
+    bool _has_capture(const String& p_capture) const override;
+    bool _capture(const String& p_message, const Array& p_data, int32_t p_session_id) override;
     //~ End EditorDebuggerPlugin Interface
 
     static OrchestratorEditorDebuggerPlugin* get_singleton() { return _singleton; }
@@ -56,6 +74,11 @@ public:
     void reload_all_scripts();
     void reload_scripts(const Vector<String>& p_script_paths);
 
+    /// Get the most recent node profiles reported for a script
+    /// @param p_path the script path
+    /// @return the profiles by node id, or null if the script has not reported any
+    const NodeProfileMap* get_node_profiles(const String& p_path) const;
+
     bool is_active() const;
     void debug_step_into();
     void debug_step_over();
@@ -21,6 +21,8 @@
 #include "orchestration/orchestration.h"
 #include "orchestration/serialization/binary/binary_serializer.h"
 #include "orchestration/serialization/text/text_parser.h"
+#include "script/compiler/bytecode_image.h"
+#include "script/script.h"
 #include "script/script_source.h"
 #include "script/serialization/format_defs.h"
 
@@ -43,24 +45,16 @@ void OrchestratorEditorExportPlugin::_export_begin(const PackedStringArray& p_fe
     // _convert_to_binary = ProjectSettings::get_singleton()->get_setting("editor/export/convert_text_resources_to_binary", true);
 }
 
-void OrchestratorEditorExportPlugin::_export_file(const String& p_path, const String& p_type, const PackedStringArray& p_features) {
-    if (!_convert_to_binary) {
-        return;
-    }
-
-    if (p_path.get_extension().to_lower() != ORCHESTRATOR_SCRIPT_TEXT_EXTENSION) {
-        return;
-    }
-
+String OrchestratorEditorExportPlugin::_export_binary(const String& p_path) {
     OScriptSource source = OScriptSource::load(p_path);
     if (source.get_source().is_empty()) {
-        return;
+        return {};
     }
 
     OrchestrationTextParser parser;
     Ref<Orchestration> orchestration = parser.load(p_path);
     if (!orchestration.is_valid()) {
-        return;
+        return {};
     }
 
     const String uid_text = GDE::ResourceUID::path_to_uid(p_path);
@@ -77,6 +71,45 @@ void OrchestratorEditorExportPlugin::_export_file(const String& p_path, const St
 
     const PackedByteArray bytes = FileAccess::get_file_as_bytes(serialized_path);
     add_file(p_path.get_basename() + ".os", bytes, true);
+
+    return serialized_path;
+}
+
+void OrchestratorEditorExportPlugin::_export_bytecode_image(const String& p_path, const OScriptSource& p_source) {
+    // The editor's compiled script is serialized, so the script must have compiled without errors.
+    const Ref<OScript> script = ResourceLoader::get_singleton()->load(p_path);
+    if (script.is_null() || !script->_is_valid() || !p_source.is_valid()) {
+        WARN_PRINT(vformat("Orchestration '%s' is exported without a bytecode image: it did not compile.", p_path));
+        return;
+    }
+
+    PackedByteArray image;
+    String reason;
+    if (OScriptBytecodeImage::save(script.ptr(), p_source.hash(), image, reason) != OK) {
+        // Scripts holding state that cannot be serialized are compiled when loaded.
+        WARN_PRINT(vformat("Orchestration '%s' is exported without a bytecode image and compiles when loaded: %s.", p_path, reason));
+        return;
+    }
+
+    add_file(OScriptBytecodeImage::get_image_path(p_path), image, false);
+}
+
+void OrchestratorEditorExportPlugin::_export_file(const String& p_path, const String& p_type, const PackedStringArray& p_features) {
+    const String extension = p_path.get_extension().to_lower();
+    if (extension != ORCHESTRATOR_SCRIPT_TEXT_EXTENSION && extension != ORCHESTRATOR_SCRIPT_EXTENSION) {
+        return;
+    }
+
+    // The image is bound to the source that ships with it, which is the converted binary when enabled.
+    String source_path = p_path;
+    if (_convert_to_binary && extension == ORCHESTRATOR_SCRIPT_TEXT_EXTENSION) {
+        source_path = _export_binary(p_path);
+        if (source_path.is_empty()) {
+            return;
+        }
+    }
+
+    _export_bytecode_image(p_path, OScriptSource::load(source_path));
 }
 
 void OrchestratorEditorExportPlugin::_bind_methods() {
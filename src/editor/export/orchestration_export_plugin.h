@@ -16,18 +16,23 @@
 //
 #pragma once
 
+#include "script/script_source.h"
+
 #include <godot_cpp/classes/editor_export_platform.hpp>
 #include <godot_cpp/classes/editor_export_plugin.hpp>
 
 using namespace godot;
 
-/// An export plugin that is responsible for converting text-based orchestrations to binary
-/// so that exported games use the fasting load times possible.
+/// An export plugin that is responsible for converting text-based orchestrations to binary and
+/// for emitting precompiled bytecode images so that exported games use the fasting load times possible.
 class OrchestratorEditorExportPlugin : public EditorExportPlugin {
     GDCLASS(OrchestratorEditorExportPlugin, EditorExportPlugin);
 
     bool _convert_to_binary = false;
 
+    String _export_binary(const String& p_path);
+    void _export_bytecode_image(const String& p_path, const OScriptSource& p_source);
+
 protected:
     static void _bind_methods();
 
@@ -86,7 +86,7 @@ OrchestratorEditorGraphClipboard::ClipboardResult OrchestratorEditorGraphClipboa
         }
     }
 
-    for (const OScriptConnection& C : p_source->get_orchestration()->get_connections()) {
+    for (const OScriptConnection& C : p_source->get_connections()) {
         if (node_ids.has(C.from_node) && node_ids.has(C.to_node)) {
             _buffer.connections.push_back(C.id);
         }
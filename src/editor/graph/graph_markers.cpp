@@ -218,9 +218,11 @@ void OrchestratorEditorGraphMarkers::clear_breakpoints() {
 
         _breakpoints.remove_at(_breakpoints.size() - 1);
         _breakpoint_state.erase(node_id);
-    }
 
-    _panel->_queue_panel_refresh();
+        if (OrchestratorEditorGraphNode* node = _panel->find_node(node_id)) {
+            node->notify_breakpoints_changed();
+        }
+    }
 }
 
 void OrchestratorEditorGraphMarkers::save_state(Dictionary& r_state) {
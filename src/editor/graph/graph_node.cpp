@@ -38,6 +38,9 @@
 #include <godot_cpp/classes/resource_loader.hpp>
 
 void OrchestratorEditorGraphNode::_resize_to_content() {
+    // Without its default value widgets, the node would persist a smaller size than it is drawn with
+    realize_pin_widgets();
+
     set_anchor_and_offset(SIDE_RIGHT, 0, 0);
     set_anchor_and_offset(SIDE_BOTTOM, 0, 0);
     _node->set_size(get_size());
@@ -432,6 +435,32 @@ Vector<OrchestratorEditorGraphPin*> OrchestratorEditorGraphNode::get_pins() cons
     return result;
 }
 
+void OrchestratorEditorGraphNode::realize_pin_widgets() {
+    if (_pin_widgets_realized) {
+        return;
+    }
+
+    _pin_widgets_realized = true;
+
+    for (const SlotMapKeyValue& E : _slots) {
+        if (E.value.left && E.value.left->is_default_value_control_pending()) {
+            E.value.left->create_default_value_control();
+        }
+    }
+
+    // Deferred from update, as the size is only complete now
+    if (ORCHESTRATOR_GET("interface/editor/graph_nodes/resize_to_content", false)) {
+        _resize_to_content();
+    }
+}
+
+Vector2 OrchestratorEditorGraphNode::get_realized_size() {
+    realize_pin_widgets();
+
+    // The node only grows to fit the new widgets once its minimum size is next applied
+    return get_size().max(get_combined_minimum_size());
+}
+
 Vector<OrchestratorEditorGraphPin*> OrchestratorEditorGraphNode::get_eligible_autowire_pins(OrchestratorEditorGraphPin* p_pin) const {
     Vector<OrchestratorEditorGraphPin*> result;
     ERR_FAIL_NULL_V(p_pin, result);
@@ -651,7 +680,7 @@ void OrchestratorEditorGraphNode::update() {
         return;
     }
 
-    if (ORCHESTRATOR_GET("interface/editor/graph_nodes/resize_to_content", false)) {
+    if (_pin_widgets_realized && ORCHESTRATOR_GET("interface/editor/graph_nodes/resize_to_content", false)) {
         _resize_to_content();
     }
 
@@ -667,6 +696,11 @@ void OrchestratorEditorGraphNode::update() {
     _create_pin_widgets();
     _create_add_button_widgets();
 
+    if (_pin_widgets_realized) {
+        _pin_widgets_realized = false;
+        realize_pin_widgets();
+    }
+
     if (get_position_offset() != _node->get_position()) {
         set_position_offset(_node->get_position());
     }
@@ -703,6 +737,34 @@ void OrchestratorEditorGraphNode::redraw_connections() {
     }
 }
 
+void OrchestratorEditorGraphNode::_draw_execution_profile() {
+    if (_profile_hit_count == 0) {
+        return;
+    }
+
+    // Cold nodes are green and the hottest node in the graph is red.
+    const Color color = Color::from_hsv((1.f - _profile_heat) / 3.f, 0.85f, 1.f);
+    draw_rect(Rect2(Vector2(), get_size()).grow(3 * EDSCALE), color, false, 3 * EDSCALE);
+
+    const Ref<Font> font = get_theme_font(SceneStringName(font), "Label");
+    const int font_size = get_theme_font_size(SceneStringName(font_size), "Label");
+    if (font.is_valid()) {
+        const String text = vformat("%d hits, %.2f ms", int64_t(_profile_hit_count), double(_profile_total_time) / 1000.0);
+        draw_string(font, Vector2(0, -8 * EDSCALE), text, HORIZONTAL_ALIGNMENT_LEFT, -1, font_size, color);
+    }
+}
+
+void OrchestratorEditorGraphNode::set_execution_profile(uint64_t p_hit_count, uint64_t p_total_time, float p_heat) {
+    if (_profile_hit_count == p_hit_count && _profile_total_time == p_total_time && _profile_heat == p_heat) {
+        return;
+    }
+
+    _profile_hit_count = p_hit_count;
+    _profile_total_time = p_total_time;
+    _profile_heat = CLAMP(p_heat, 0.f, 1.f);
+    queue_redraw();
+}
+
 void OrchestratorEditorGraphNode::notify_connections_changed() {
     // No-op - is there anything to do here?
 }
@@ -730,6 +792,10 @@ void OrchestratorEditorGraphNode::_notification(int p_what) {
             redraw_connections();
             break;
         }
+        case NOTIFICATION_DRAW: {
+            _draw_execution_profile();
+            break;
+        }
         case NOTIFICATION_MOUSE_ENTER: {
             // Lazily build the wrapped tooltip the first time the node is hovered; this
             // happens well before the tooltip's hover delay, so it is ready when shown.
@@ -41,6 +41,14 @@ class OrchestratorEditorGraphNode : public GraphNode {
     bool _show_type_icons = true;
     bool _show_advanced_tooltips = false;
     bool _tooltip_built = false;
+    bool _pin_widgets_realized = false;
+
+    // Execution profile reported by the debugger, drawn as a heatmap outline
+    uint64_t _profile_hit_count = 0;
+    uint64_t _profile_total_time = 0;
+    float _profile_heat = 0.f;
+
+    void _draw_execution_profile();
 
 protected:
     struct Slot {
@@ -110,6 +118,13 @@ public:
 
     Vector<OrchestratorEditorGraphPin*> get_pins() const;
 
+    // Pin default value widgets are deferred until the node first scrolls into the panel's view
+    void realize_pin_widgets();
+    bool are_pin_widgets_realized() const { return _pin_widgets_realized; }
+
+    // The node's size once its pin default value widgets are realized, used wherever sizes are persisted or compared
+    Vector2 get_realized_size();
+
     Vector<OrchestratorEditorGraphPin*> get_eligible_autowire_pins(OrchestratorEditorGraphPin* p_pin) const;
 
     // These expect you to use get_input_port_slot/get_output_port_slot methods first
@@ -145,6 +160,12 @@ public:
     void set_show_advanced_tooltips(bool p_show_advanced_tooltips);
     void set_slot_color_opacity(float p_opacity, EPinDirection p_direction = PD_MAX);
 
+    /// Sets the node's execution profile, or clears it when the hit count is 0
+    /// @param p_hit_count the number of times the node executed
+    /// @param p_total_time the time spent in the node, in microseconds
+    /// @param p_heat the node's time relative to the hottest node in the graph, between 0 and 1
+    void set_execution_profile(uint64_t p_hit_count, uint64_t p_total_time, float p_heat);
+
     // Provides a way for an external actor to refresh the node
     // It's also virtual to allow derived classes to change how nodes are composed
     virtual void update();
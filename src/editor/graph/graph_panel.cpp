@@ -33,6 +33,7 @@
 #include "editor/actions/registry.h"
 #include "editor/actions/rules/override_function_rule.h"
 #include "editor/autowire_connection_dialog.h"
+#include "editor/debugger/script_debugger_plugin.h"
 #include "editor/graph/graph_markers.h"
 #include "editor/graph/graph_node.h"
 #include "editor/graph/graph_node_factory.h"
@@ -66,6 +67,7 @@
 #include <godot_cpp/classes/script_editor.hpp>
 #include <godot_cpp/classes/style_box_flat.hpp>
 #include <godot_cpp/classes/theme.hpp>
+#include <godot_cpp/classes/time.hpp>
 #include <godot_cpp/classes/tween.hpp>
 #include <godot_cpp/classes/v_separator.hpp>
 
@@ -321,6 +323,7 @@ void OrchestratorEditorGraphPanel::_end_node_move() {
 }
 
 void OrchestratorEditorGraphPanel::_scroll_offset_changed(const Vector2& p_scroll_offset) {
+    _queue_realize_visible_nodes();
 }
 
 void OrchestratorEditorGraphPanel::_update_panel_hint() {
@@ -677,6 +680,7 @@ void OrchestratorEditorGraphPanel::_node_added(int p_node_id) {
         if (node.is_valid()) {
             _add_node_to_panel(node);
             _update_center_status();
+            _queue_realize_visible_nodes();
 
             emit_signal("validate_script");
         }
@@ -834,7 +838,7 @@ void OrchestratorEditorGraphPanel::_collapse_selected_nodes_to_function() {
     HashSet<uint64_t> connections;
     HashSet<uint64_t> input_connections;
     HashSet<uint64_t> output_connections;
-    for (const Connection& C : _graph->get_orchestration()->get_connections()) {
+    for (const Connection& C : _graph->get_connections()) {
         if (node_set.has(C.from_node) && node_set.has(C.to_node)) {
             connections.insert(C.id);
         }
@@ -1151,7 +1155,7 @@ void OrchestratorEditorGraphPanel::_align_nodes(OrchestratorEditorGraphNode* p_a
         node_obj->_node->set_position(node_obj->get_position_offset());
 
     const Vector2 align_offset = p_anchor->get_position_offset();
-    const Vector2 align_size = p_anchor->get_size();
+    const Vector2 align_size = p_anchor->get_realized_size();
 
     switch (p_alignment) {
         case ALIGN_TOP: {
@@ -1168,7 +1172,7 @@ void OrchestratorEditorGraphPanel::_align_nodes(OrchestratorEditorGraphNode* p_a
             // Align all selected nodes to center to this specific node.
             const float mid_y = align_offset.y + (align_size.y / 2);
             for_each<OrchestratorEditorGraphNode>([&] (OrchestratorEditorGraphNode* node) {
-                const float node_mid_y = node->get_position_offset().y + (node->get_size().y / 2);
+                const float node_mid_y = node->get_position_offset().y + (node->get_realized_size().y / 2);
                 SET_NODE_POS(node, node->get_position_offset() + Vector2(0, mid_y - node_mid_y));
             }, true);
             _set_edited(true);
@@ -1178,7 +1182,7 @@ void OrchestratorEditorGraphPanel::_align_nodes(OrchestratorEditorGraphNode* p_a
             // Align all selected nodes to match bottom of this specific node.
             const float bottom = align_offset.y + align_size.y;
             for_each<OrchestratorEditorGraphNode>([&] (OrchestratorEditorGraphNode* node) {
-                const float adjust = bottom - (node->get_position_offset().y + node->get_size().y);
+                const float adjust = bottom - (node->get_position_offset().y + node->get_realized_size().y);
                 SET_NODE_POS(node, node->get_position_offset() + Vector2(0, adjust));
             }, true);
             _set_edited(true);
@@ -1198,7 +1202,7 @@ void OrchestratorEditorGraphPanel::_align_nodes(OrchestratorEditorGraphNode* p_a
             // Align all selected nodes to center to this specific node.
             const float mid_x = align_offset.x + (align_size.x / 2);
             for_each<OrchestratorEditorGraphNode>([&] (OrchestratorEditorGraphNode* node) {
-                const float node_mid_x = node->get_position_offset().x + (node->get_size().x / 2);
+                const float node_mid_x = node->get_position_offset().x + (node->get_realized_size().x / 2);
                 SET_NODE_POS(node, node->get_position_offset() + Vector2(mid_x - node_mid_x, 0));
             }, true);
             _set_edited(true);
@@ -1208,7 +1212,7 @@ void OrchestratorEditorGraphPanel::_align_nodes(OrchestratorEditorGraphNode* p_a
             // Align all selected nodes to this specific node.
             const float right = align_offset.x + align_size.x;
             for_each<OrchestratorEditorGraphNode>([&] (OrchestratorEditorGraphNode* node) {
-                const float adjust = right - (node->get_position_offset().x + node->get_size().x);
+                const float adjust = right - (node->get_position_offset().x + node->get_realized_size().x);
                 SET_NODE_POS(node, node->get_position_offset() + Vector2(adjust, 0));
             }, true);
             _set_edited(true);
@@ -1817,6 +1821,36 @@ void OrchestratorEditorGraphPanel::_grid_pattern_changed(int p_index) {
     set_grid_pattern(CAST_INT_TO_ENUM(GridPattern, _grid_pattern->get_item_metadata(p_index)));
 }
 
+void OrchestratorEditorGraphPanel::_node_profiles_updated() {
+    OrchestratorEditorDebuggerPlugin* debugger = OrchestratorEditorDebuggerPlugin::get_singleton();
+    if (!debugger || !_graph.is_valid()) {
+        return;
+    }
+
+    const OrchestratorEditorDebuggerPlugin::NodeProfileMap* profiles =
+        debugger->get_node_profiles(_graph->get_orchestration()->as_script()->get_path());
+
+    // Heat is relative to the hottest node within this graph, not the whole orchestration.
+    uint64_t max_time = 0;
+    if (profiles) {
+        for_each<OrchestratorEditorGraphNode>([&] (OrchestratorEditorGraphNode* node) {
+            if (const OrchestratorEditorDebuggerPlugin::NodeProfile* profile = profiles->getptr(node->get_id())) {
+                max_time = MAX(max_time, profile->total_time);
+            }
+        });
+    }
+
+    for_each<OrchestratorEditorGraphNode>([&] (OrchestratorEditorGraphNode* node) {
+        const OrchestratorEditorDebuggerPlugin::NodeProfile* profile = profiles ? profiles->getptr(node->get_id()) : nullptr;
+        if (profile) {
+            const float heat = max_time > 0 ? float(double(profile->total_time) / double(max_time)) : 0.f;
+            node->set_execution_profile(profile->hit_count, profile->total_time, heat);
+        } else {
+            node->set_execution_profile(0, 0, 0.f);
+        }
+    });
+}
+
 void OrchestratorEditorGraphPanel::_settings_changed() {
     if (_theme_update_timer->is_inside_tree()) {
         if (!_theme_update_timer->is_stopped()) {
@@ -1967,6 +2001,38 @@ void OrchestratorEditorGraphPanel::_schedule_refresh() {
     get_tree()->connect("process_frame", callable_mp_this(_refresh_panel_with_model), CONNECT_ONE_SHOT);
 }
 
+void OrchestratorEditorGraphPanel::_queue_realize_visible_nodes() {
+    if (_realize_visible_nodes_pending) {
+        return;
+    }
+
+    _realize_visible_nodes_pending = true;
+    callable_mp_this(_realize_visible_nodes).call_deferred();
+}
+
+void OrchestratorEditorGraphPanel::_realize_visible_nodes() {
+    _realize_visible_nodes_pending = false;
+
+    if (!is_visible_in_tree()) {
+        return;
+    }
+
+    // Nodes only create their pin default value widgets (line edits, pickers, etc.) once they come
+    // within a margin of the visible area, so large graphs do not pay for thousands of off-screen
+    // controls when opened. Once created, widgets are kept, so this only ever does work as nodes
+    // are scrolled into view for the first time.
+    const float zoom = get_zoom();
+    const Rect2 visible_rect = Rect2(get_scroll_offset() / zoom, get_size() / zoom).grow(VISIBLE_NODE_MARGIN / zoom);
+
+    for_each<OrchestratorEditorGraphNode>([&](OrchestratorEditorGraphNode* node) {
+        if (!node->are_pin_widgets_realized() && !node->is_queued_for_deletion()) {
+            if (visible_rect.intersects(Rect2(node->get_position_offset(), node->get_size()))) {
+                node->realize_pin_widgets();
+            }
+        }
+    });
+}
+
 void OrchestratorEditorGraphPanel::_queue_autowire(OrchestratorEditorGraphNode* p_spawned_node, OrchestratorEditorGraphPin* p_origin_pin) {
     ERR_FAIL_NULL_MSG(p_spawned_node, "Cannot initiate an autowire operation with an invalid node reference");
     ERR_FAIL_NULL_MSG(p_origin_pin, "Cannot initiate an autowire operation with an invalid pin reference");
@@ -2111,7 +2177,88 @@ void OrchestratorEditorGraphPanel::_add_node_to_panel(const Ref<OrchestrationGra
 }
 
 void OrchestratorEditorGraphPanel::_remove_node_from_panel(const Ref<OrchestrationGraphNode>& p_node) {
+    ERR_FAIL_COND(p_node.is_null());
+
+    if (GraphElement* element = cast_to<GraphElement>(get_node_or_null(NodePath(itos(p_node->get_id()))))) {
+        _remove_element_from_panel(element);
+    }
+}
+
+void OrchestratorEditorGraphPanel::_remove_element_from_panel(GraphElement* p_element) {
+    ERR_FAIL_NULL(p_element);
+
+    // Drop the element's connections first, the connection sync reconnects any that remain in the model
+    // once a replacement element with the same name has been added.
+    const uint64_t node_id = String(p_element->get_name()).to_int();
+
+    Vector<uint64_t> linked;
+    for (const uint64_t connection_id : _panel_connections) {
+        Connection C;
+        C.id = connection_id;
+        if (C.is_linked_to(node_id)) {
+            linked.push_back(connection_id);
+        }
+    }
+
+    for (const uint64_t connection_id : linked) {
+        Connection C;
+        C.id = connection_id;
+        disconnect_node(itos(C.from_node), C.from_port, itos(C.to_node), C.to_port);
+        _panel_connections.erase(connection_id);
+    }
+
+    if (p_element->is_selected()) {
+        p_element->set_selected(false);
+    }
+
+    // Removed immediately so that the name is free for a replacement element in the same refresh
+    remove_child(p_element);
+    p_element->queue_free();
+}
+
+Ref<OrchestrationGraphNode> OrchestratorEditorGraphPanel::_get_element_graph_node(GraphElement* p_element) const {
+    if (OrchestratorEditorGraphNode* node = cast_to<OrchestratorEditorGraphNode>(p_element)) {
+        return node->get_graph_node();
+    }
+    if (OrchestratorEditorGraphFrame* frame = cast_to<OrchestratorEditorGraphFrame>(p_element)) {
+        return frame->_comment;
+    }
+    return {};
+}
 
+bool OrchestratorEditorGraphPanel::_sync_panel_connections() {
+    bool changed = false;
+
+    HashSet<uint64_t> model_connections;
+    for (const Connection& E : _graph->get_connections()) {
+        model_connections.insert(E.id);
+        if (_panel_connections.has(E.id)) {
+            continue;
+        }
+
+        Error err = connect_node(itos(E.from_node), E.from_port, itos(E.to_node), E.to_port);
+        ERR_CONTINUE_MSG(err != OK, "Failed to create graph connection for connection id " + itos(E.id));
+
+        _panel_connections.insert(E.id);
+        changed = true;
+    }
+
+    Vector<uint64_t> stale;
+    for (const uint64_t connection_id : _panel_connections) {
+        if (!model_connections.has(connection_id)) {
+            stale.push_back(connection_id);
+        }
+    }
+
+    for (const uint64_t connection_id : stale) {
+        Connection C;
+        C.id = connection_id;
+        disconnect_node(itos(C.from_node), C.from_port, itos(C.to_node), C.to_port);
+        _panel_connections.erase(connection_id);
+        changed = true;
+    }
+
+    return changed;
 }
 
 void OrchestratorEditorGraphPanel::_refresh_panel_with_model() {
@@ -2123,26 +2270,60 @@ void OrchestratorEditorGraphPanel::_refresh_panel_with_model() {
         return;
     }
 
-    clear_connections();
+    const uint64_t start_time = Time::get_singleton()->get_ticks_usec();
 
+    // Rather than tearing down and recreating every element, the panel is patched against the model.
+    // Elements whose model node is unchanged are kept as-is, as they track their node's changes on
+    // their own; only nodes that were added, removed, or replaced (i.e. reloaded from file) are
+    // touched, and only connections that differ are added or removed.
+    HashMap<int, GraphElement*> elements;
     for (int i = get_child_count() - 1; i >= 0; i--) {
         GraphElement* element = cast_to<GraphElement>(get_child(i));
-        if (element) {
+        if (!element) {
+            continue;
+        }
+
+        // Elements removed by the user are only queued for deletion, take them out of the tree now
+        // so their names cannot collide with elements added by this refresh.
+        if (element->is_queued_for_deletion()) {
             remove_child(element);
-            element->queue_free();
+            continue;
         }
+
+        elements[String(element->get_name()).to_int()] = element;
     }
 
+    int added = 0;
+    int removed = 0;
     for (const Ref<OrchestrationGraphNode>& node : _graph->get_nodes()) {
+        if (GraphElement** existing = elements.getptr(node->get_id())) {
+            GraphElement* element = *existing;
+            elements.erase(node->get_id());
+
+            if (_get_element_graph_node(element) == node) {
+                continue;
+            }
+
+            _remove_element_from_panel(element);
+            removed++;
+        }
+
         _add_node_to_panel(node);
+        added++;
     }
 
-    for (const Connection& E : _graph->get_connections()) {
-        Error err = connect_node(itos(E.from_node), E.from_port, itos(E.to_node), E.to_port);
-        ERR_CONTINUE_MSG(err != OK, "Failed to create graph connection for connection id " + itos(E.id));
+    for (const KeyValue<int, GraphElement*>& E : elements) {
+        _remove_element_from_panel(E.value);
+        removed++;
     }
 
-    _restore_frame_attachments();
+    _sync_panel_connections();
+
+    if (added > 0) {
+        _restore_frame_attachments();
+        _queue_realize_visible_nodes();
+    }
+    _node_profiles_updated();
 
     // Queue up a revalidation sequence
     emit_signal("validate_script");
@@ -2150,15 +2331,13 @@ void OrchestratorEditorGraphPanel::_refresh_panel_with_model() {
     _update_center_status();
 
     _panel_refresh_pending = false;
+
+    print_verbose(vformat("Orchestrator: Refreshed graph '%s' in %d usec (%d added, %d removed).",
+        _graph->get_graph_name(), Time::get_singleton()->get_ticks_usec() - start_time, added, removed));
 }
 
 void OrchestratorEditorGraphPanel::_refresh_panel_connections_with_model() {
-    clear_connections();
-
-    for (const Connection& E : _graph->get_connections()) {
-        Error err = connect_node(itos(E.from_node), E.from_port, itos(E.to_node), E.to_port);
-        ERR_CONTINUE_MSG(err != OK, "Failed to create graph connection for connection id " + itos(E.id));
-    }
+    _sync_panel_connections();
 
     emit_signal("connections_changed");
     emit_signal("validate_script");
@@ -2372,15 +2551,13 @@ void OrchestratorEditorGraphPanel::_dissolve_selected_reroutes() {
         return;
     }
 
-    const RBSet<OScriptConnection>& all_connections = _graph->get_orchestration()->get_connections();
-
     for (OrchestratorEditorGraphNodeReroute* reroute : reroutes) {
         const int reroute_id = reroute->get_id();
 
         OScriptConnection incoming, outgoing;
         int incoming_count = 0, outgoing_count = 0;
 
-        for (const OScriptConnection& C : all_connections) {
+        for (const OScriptConnection& C : _graph->get_connections()) {
             if (C.to_node == static_cast<uint64_t>(reroute_id)) {
                 incoming = C;
                 incoming_count++;
@@ -2633,7 +2810,7 @@ void OrchestratorEditorGraphPanel::_gui_input(const Ref<InputEvent>& p_event) {
 
                             const int reroute_id = reroute->get_id();
                             int in_count = 0, out_count = 0;
-                            for (const OScriptConnection& C : _graph->get_orchestration()->get_connections()) {
+                            for (const OScriptConnection& C : _graph->get_connections()) {
                                 if (C.to_node == static_cast<uint64_t>(reroute_id)) {
                                     in_count++;
                                 } else if (C.from_node == static_cast<uint64_t>(reroute_id)) {
@@ -3498,6 +3675,18 @@ void OrchestratorEditorGraphPanel::set_edit_state(const Variant& p_state, const
 
 void OrchestratorEditorGraphPanel::_notification(int p_what) {
     switch (p_what) {
+        case NOTIFICATION_ENTER_TREE: {
+            if (OrchestratorEditorDebuggerPlugin* debugger = OrchestratorEditorDebuggerPlugin::get_singleton()) {
+                debugger->connect("node_profiles_updated", callable_mp_this(_node_profiles_updated));
+            }
+            break;
+        }
+        case NOTIFICATION_EXIT_TREE: {
+            if (OrchestratorEditorDebuggerPlugin* debugger = OrchestratorEditorDebuggerPlugin::get_singleton()) {
+                debugger->disconnect("node_profiles_updated", callable_mp_this(_node_profiles_updated));
+            }
+            break;
+        }
         case NOTIFICATION_THEME_CHANGED: {
             _update_theme_item_cache();
             _update_menu_theme();
@@ -3513,9 +3702,14 @@ void OrchestratorEditorGraphPanel::_notification(int p_what) {
                 if (!_initialized) {
                     _schedule_restore();
                 }
+                _queue_realize_visible_nodes();
             }
             break;
         }
+        case NOTIFICATION_RESIZED: {
+            _queue_realize_visible_nodes();
+            break;
+        }
         default: {
             break;
         }
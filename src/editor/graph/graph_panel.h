@@ -95,6 +95,9 @@ private:
         Ref<StyleBox> panel;
     } _theme_cache;
 
+    // Distance outside the visible area, in screen pixels, at which nodes create their pin widgets
+    static constexpr float VISIBLE_NODE_MARGIN = 256.f;
+
     struct PinHandle {
         uint64_t node_id;
         int32_t pin_port;
@@ -137,6 +140,8 @@ private:
     bool _panel_refresh_pending = false;
     bool _panel_connections_refresh_pending = false;
     bool _refresh_scheduled = false;
+    bool _realize_visible_nodes_pending = false;
+    HashSet<uint64_t> _panel_connections;            // Connection ids currently drawn by the panel
 
 
     Vector2 _menu_position;
@@ -243,6 +248,7 @@ private:
 
     void _grid_pattern_changed(int p_index);
     void _settings_changed();
+    void _node_profiles_updated();
     void _show_drag_hint(const String& p_hint_text) const;
     bool _is_delete_confirmation_enabled();
     bool _can_duplicate_nodes(const Vector<OrchestratorEditorGraphNode*>& p_nodes, bool p_error_dialog = true);
@@ -250,6 +256,8 @@ private:
     void _schedule_restore();
     void _restore_edit_state();
     void _schedule_refresh();
+    void _queue_realize_visible_nodes();
+    void _realize_visible_nodes();
 
     void _queue_autowire(OrchestratorEditorGraphNode* p_spawned_node, OrchestratorEditorGraphPin* p_origin_pin);
     OrchestratorEditorGraphPin* _get_autowire_pin(OrchestratorEditorGraphNode* p_spawned_node, OrchestratorEditorGraphPin* p_origin_pin, const Vector<OrchestratorEditorGraphPin*>& p_choices);
@@ -262,6 +270,9 @@ private:
 
     virtual void _add_node_to_panel(const Ref<OrchestrationGraphNode>& p_node);
     virtual void _remove_node_from_panel(const Ref<OrchestrationGraphNode>& p_node);
+    void _remove_element_from_panel(GraphElement* p_element);
+    Ref<OrchestrationGraphNode> _get_element_graph_node(GraphElement* p_element) const;
+    bool _sync_panel_connections();
     virtual void _refresh_panel_with_model();
     virtual void _refresh_panel_connections_with_model();
 
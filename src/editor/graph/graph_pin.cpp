@@ -288,18 +288,13 @@ void OrchestratorEditorGraphPin::_create_pin_layout() {
     }
 
     if (!_pin->is_execution() && !_pin->is_default_ignored() && _pin->is_input()) {
-        _default_value = _create_default_value_widget();
-        if (_default_value) {
-            _default_value->set_visible(!is_linked());
-
-            // For multiline input, the default value widget is rendered on the second row of
-            // the VBoxContainer, which is this class; otherwise, it's appended to the right
-            // inside the HBoxContainer on the first row of this class.
-            if (_is_default_value_below_label()) {
-                add_child(_default_value);
-            } else {
-                container->add_child(_default_value);
-            }
+        _default_value_row = container;
+        _default_value_pending = true;
+
+        // Default value widgets are the bulk of a node's controls, so they're only created once the
+        // owning node is scrolled into view, see OrchestratorEditorGraphNode::realize_pin_widgets.
+        if (!_is_default_value_widget_deferred()) {
+            create_default_value_control();
         }
     }
 }
@@ -505,6 +500,33 @@ const PropertyInfo& OrchestratorEditorGraphPin::get_property_info() const {
     return _pin->get_property_info();
 }
 
+void OrchestratorEditorGraphPin::create_default_value_control() {
+    if (!_default_value_pending) {
+        return;
+    }
+
+    _default_value_pending = false;
+
+    _default_value = _create_default_value_widget();
+    if (_default_value) {
+        _default_value->set_visible(!is_linked());
+
+        // For multiline input, the default value widget is rendered on the second row of
+        // the VBoxContainer, which is this class; otherwise, it's appended to the right
+        // inside the HBoxContainer on the first row of this class.
+        if (_is_default_value_below_label()) {
+            add_child(_default_value);
+        } else {
+            _default_value_row->add_child(_default_value);
+        }
+
+        // When created lazily, the pin's value must be pushed into the newly created widget
+        if (_pin.is_valid() && is_inside_tree()) {
+            _update_control_value(_pin->get_effective_default_value());
+        }
+    }
+}
+
 void OrchestratorEditorGraphPin::set_default_value_control_visible(bool p_visible) {
     GUARD_NULL(_default_value);
     _default_value->set_visible(p_visible);
@@ -73,6 +73,8 @@ class OrchestratorEditorGraphPin : public VBoxContainer {
     Control* _icon = nullptr;
     Label* _label = nullptr;
     Control* _default_value = nullptr;
+    HBoxContainer* _default_value_row = nullptr;
+    bool _default_value_pending = false;
 
     Vector2i _get_icon_scaled_size(const Ref<Texture2D>& p_icon, int p_editor_icon_size) const;
     void _update_icon_control();
@@ -101,6 +103,7 @@ protected:
     void _create_pin_layout();
     virtual bool _is_default_value_below_label() const { return false; }
     virtual Control* _create_default_value_widget() { return nullptr; }
+    virtual bool _is_default_value_widget_deferred() const { return true; }
 
     virtual String _get_label_text();
     virtual String _get_tooltip_text();
@@ -132,6 +135,9 @@ public:
 
     const PropertyInfo& get_property_info() const;
 
+    bool is_default_value_control_pending() const { return _default_value_pending; }
+    void create_default_value_control();
+
     void set_default_value_control_visible(bool p_visible);
     void set_icon_visible(bool p_visible);
     void set_show_advanced_tooltips(bool p_show_advanced_tooltips);
@@ -70,6 +70,8 @@ protected:
     //~ End OrchestratorEditorGraphPinButtonBase Interface
 
     //~ Begin OrchestratorEditorGraphPin Interface
+    // The selector button state is configured from the pin's dependencies when the pin is set
+    bool _is_default_value_widget_deferred() const override { return false; }
     void set_pin(const Ref<OrchestrationGraphPin>& p_pin) override;
     //~ End OrchestratorEditorGraphPin Interface
 
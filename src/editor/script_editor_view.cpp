@@ -46,6 +46,7 @@
 #include <godot_cpp/classes/popup_menu.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/classes/v_separator.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 
 void OrchestratorScriptGraphEditorView::_idle_timeout() {
     for (int i = 0; i < _tab_container->get_child_count(); i++) {
@@ -667,11 +668,54 @@ void OrchestratorScriptGraphEditorView::_validate_script() {
         return;
     }
 
-    List<String> functions;
-    _warnings.clear();
-    _errors.clear();
+    // Any newer edit supersedes the pass in flight. Only one pass runs at a time, and once the current
+    // one completes, its results are discarded and the script is validated again.
+    const uint64_t generation = _validation_generation.increment();
+    if (_validation_task != -1) {
+        _validation_pending = true;
+        return;
+    }
+
+    // Parsing and analysis run on a worker thread against a snapshot, so edits made in the meantime
+    // cannot be observed half-applied.
+    const Ref<Orchestration> snapshot = _script->get_orchestration()->create_snapshot();
+    if (snapshot.is_null()) {
+        return;
+    }
+
+    const String path = _script->get_path();
+
+    _validation_task = WorkerThreadPool::get_singleton()->add_task(callable_mp_lambda(this, [this, language, snapshot, path, generation] {
+        ValidationResult result;
+        result.generation = generation;
+
+        if (generation == _validation_generation.get()) {
+            result.valid = language->validate_orchestration(snapshot, path, &result.functions, &result.warnings, &result.errors);
+        }
+
+        // The main thread only reads the result after this task completes.
+        _validation_result = result;
+
+        callable_mp_this(_validate_script_completed).call_deferred();
+    }), false, "Validate orchestration");
+}
+
+void OrchestratorScriptGraphEditorView::_validate_script_completed() {
+    _wait_for_validation();
 
-    if (language->validate(_script, _script->get_path(), &functions, &_warnings, &_errors)) {
+    if (_validation_pending || _validation_result.generation != _validation_generation.get()) {
+        _validate_script();
+        return;
+    }
+
+    if (!_script.is_valid()) {
+        return;
+    }
+
+    _warnings = _validation_result.warnings;
+    _errors = _validation_result.errors;
+
+    if (_validation_result.valid) {
         if (!_script->is_tool()) {
             _script->_update_exports();
         }
@@ -684,6 +728,13 @@ void OrchestratorScriptGraphEditorView::_validate_script() {
     emit_signal("edited_script_changed");
 }
 
+void OrchestratorScriptGraphEditorView::_wait_for_validation() {
+    if (_validation_task != -1) {
+        WorkerThreadPool::get_singleton()->wait_for_task_completion(_validation_task);
+        _validation_task = -1;
+    }
+}
+
 void OrchestratorScriptGraphEditorView::_show_warnings_panel(bool p_show) {
     _warnings_panel->set_visible(p_show);
 }
@@ -1244,6 +1295,9 @@ OrchestratorScriptGraphEditorView::OrchestratorScriptGraphEditorView() {
 }
 
 OrchestratorScriptGraphEditorView::~OrchestratorScriptGraphEditorView() {
+    // The validation task refers to this view, it must finish before the view goes away.
+    _wait_for_validation();
+
     if (!_editor_enabled) {
         memdelete(_edit_hb);
         memdelete(_edit_menu);
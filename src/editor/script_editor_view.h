@@ -27,6 +27,7 @@
 #include <godot_cpp/classes/scroll_container.hpp>
 #include <godot_cpp/classes/tab_container.hpp>
 #include <godot_cpp/classes/timer.hpp>
+#include <godot_cpp/templates/safe_refcount.hpp>
 
 using namespace godot;
 
@@ -68,11 +69,24 @@ class OrchestratorScriptGraphEditorView : public OrchestratorEditorView {
         DEBUG_CONTINUE
     };
 
+    // Results of a validation pass, written by the worker task and read on the main thread
+    struct ValidationResult {
+        uint64_t generation = 0;
+        bool valid = false;
+        List<String> functions;
+        List<OScriptLanguage::Warning> warnings;
+        List<OScriptLanguage::ScriptError> errors;
+    };
+
     Ref<OScript> _script;
 
     List<OScriptLanguage::Warning> _warnings;
     List<OScriptLanguage::ScriptError> _errors;
 
+    SafeNumeric<uint64_t> _validation_generation;
+    int64_t _validation_task = -1;
+    ValidationResult _validation_result;
+
     Dictionary _editor_state;
     Vector<String> _restore_tab_list;
 
@@ -153,6 +167,8 @@ protected:
 
     void _queue_validate_script();
     void _validate_script();
+    void _validate_script_completed();
+    void _wait_for_validation();
 
     void _show_warnings_panel(bool p_show);
     void _warning_clicked(const Variant& p_node);
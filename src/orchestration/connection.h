@@ -65,6 +65,28 @@ struct OScriptConnection {
     OScriptConnection() : from_node(0), from_port(0), to_node(0), to_port(0) { }
 };
 
+/// A read-only run of connection ids, in connection order, owned by an <code>Orchestration</code>.
+/// A span is only valid until the orchestration's connections change.
+struct OScriptConnectionSpan {
+    struct Iterator {
+        const uint64_t* ptr = nullptr;
+
+        OScriptConnection operator*() const { return OScriptConnection(*ptr); }
+        Iterator& operator++() { ptr++; return *this; }
+        bool operator!=(const Iterator& p_other) const { return ptr != p_other.ptr; }
+    };
+
+    const uint64_t* ids = nullptr;
+    uint32_t count = 0;
+
+    bool is_empty() const { return count == 0; }
+    uint32_t size() const { return count; }
+    OScriptConnection operator[](uint32_t p_index) const { return OScriptConnection(ids[p_index]); }
+
+    Iterator begin() const { return { ids }; }
+    Iterator end() const { return { ids + count }; }
+};
+
 // Represents all different types of active connections for a Vector<Ref<OScriptNode>> set.
 struct NodeSetConnections
 {
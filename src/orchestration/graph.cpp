@@ -35,6 +35,7 @@ void OScriptGraph::_set_nodes(const TypedArray<int>& p_nodes) {
     for (uint32_t i = 0; i < p_nodes.size(); i++) {
         _nodes.insert(p_nodes[i]);
     }
+    _connections_dirty = true;
     emit_changed();
 }
 
@@ -89,9 +90,34 @@ void OScriptGraph::_initialize_node(const Ref<OScriptNode>& p_node, const OScrip
     // add_node(p_node);
 }
 
+void OScriptGraph::_connection_added(const OScriptConnection& p_connection) {
+    if (!_connections_dirty && (_nodes.has(p_connection.from_node) || _nodes.has(p_connection.to_node))) {
+        _connections.insert(p_connection);
+    }
+}
+
+void OScriptGraph::_connection_removed(const OScriptConnection& p_connection) {
+    if (!_connections_dirty) {
+        _connections.erase(p_connection);
+    }
+}
+
 void OScriptGraph::_remove_node(int p_node_id) {
     _nodes.erase(p_node_id);
 
+    if (!_connections_dirty) {
+        // Connections to other nodes in this graph stay in the index
+        List<OScriptConnection> removals;
+        for (const OScriptConnection& E : _connections) {
+            if (E.is_linked_to(p_node_id) && !_nodes.has(E.from_node) && !_nodes.has(E.to_node)) {
+                removals.push_back(E);
+            }
+        }
+        for (const OScriptConnection& E : removals) {
+            _connections.erase(E);
+        }
+    }
+
     HashSet<uint64_t> connection_ids;
     for (const KeyValue<uint64_t, PackedVector2Array>& E : _knots) {
         OScriptConnection C(E.key);
@@ -304,6 +330,10 @@ void OScriptGraph::sanitize_nodes() {
         }
     }
 
+    if (!remove_queue.is_empty()) {
+        _connections_dirty = true;
+    }
+
     while (!remove_queue.is_empty()) {
         _nodes.erase(remove_queue.front()->get());
         remove_queue.pop_front();
@@ -322,14 +352,17 @@ Vector<Ref<OScriptNode>> OScriptGraph::get_nodes() const {
     return nodes;
 }
 
-RBSet<OScriptConnection> OScriptGraph::get_connections() const {
-    RBSet<OScriptConnection> connections;
-    for (const OScriptConnection& E : _orchestration->get_connections()) {
-        if (_nodes.has(E.from_node) || _nodes.has(E.to_node)) {
-            connections.insert(E);
+const RBSet<OScriptConnection>& OScriptGraph::get_connections() const {
+    if (_connections_dirty) {
+        _connections.clear();
+        for (const OScriptConnection& E : _orchestration->get_connections()) {
+            if (_nodes.has(E.from_node) || _nodes.has(E.to_node)) {
+                _connections.insert(E);
+            }
         }
+        _connections_dirty = false;
     }
-    return connections;
+    return _connections;
 }
 
 void OScriptGraph::link(int p_source_id, int p_source_port, int p_target_id, int p_target_port) {
@@ -347,6 +380,13 @@ Ref<OScriptNode> OScriptGraph::get_node(int p_node_id) const {
 void OScriptGraph::add_node(const Ref<OScriptNode>& p_node) {
     _nodes.insert(p_node->get_id());
 
+    if (!_connections_dirty) {
+        // A node moved from another graph brings its connections along
+        for (const OScriptConnection& E : _orchestration->_get_node_connections(p_node->get_id())) {
+            _connections.insert(E);
+        }
+    }
+
     // script_view#_create_new_function
     const Ref<OScriptNodeFunctionEntry> function_entry = p_node;
     if (function_entry.is_valid() && _flags.has_flag(GF_FUNCTION) && !_functions.has(p_node->get_id())) {
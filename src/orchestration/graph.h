@@ -67,6 +67,8 @@ private:
     RBSet<int> _nodes;                             //! Set of node ids that participate in this graph
     RBSet<int> _functions;                         //! Set of node ids that represent entry points or functions
     HashMap<uint64_t, PackedVector2Array> _knots;  //! Knots for each graph connection
+    mutable RBSet<OScriptConnection> _connections; //! Connections with either node in this graph
+    mutable bool _connections_dirty = true;        //! Whether the connection index must be rebuilt
 
     //~ Begin Serialization
     TypedArray<int> _get_nodes() const;
@@ -87,6 +89,17 @@ private:
     /// @param p_node_id the node id to be removed
     void _remove_node(int p_node_id);
 
+    /// Updates the connection index after a connection is added to the orchestration
+    /// @param p_connection the connection
+    void _connection_added(const OScriptConnection& p_connection);
+
+    /// Updates the connection index after a connection is removed from the orchestration
+    /// @param p_connection the connection
+    void _connection_removed(const OScriptConnection& p_connection);
+
+    /// Discards the connection index, it is rebuilt on the next access
+    void _invalidate_connections() { _connections_dirty = true; }
+
     /// Constructor
     /// Intentionally protected, graphs created via an Orchestration
     OScriptGraph() = default;
@@ -136,9 +149,10 @@ public:
     /// @param p_flags bit field of flags
     void set_flags(BitField<GraphFlags> p_flags);
 
-    /// Get all connections within this graph
+    /// Get all connections within this graph, those with either node in this graph. The index is kept
+    /// in sync with the orchestration, so the set must not be held while connections change.
     /// @return the graph connections
-    RBSet<OScriptConnection> get_connections() const;
+    const RBSet<OScriptConnection>& get_connections() const;
 
     /// Links two ports between a source and target node within this graph
     /// @param p_source_id the source node id
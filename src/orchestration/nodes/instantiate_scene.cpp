@@ -24,12 +24,16 @@
 
 void OScriptNodeInstantiateScene::_get_property_list(List<PropertyInfo>* r_list) const {
     r_list->push_back(PropertyInfo(Variant::STRING, "scene", PROPERTY_HINT_FILE, "*.scn,*.tscn"));
+    r_list->push_back(PropertyInfo(Variant::INT, "pool_size", PROPERTY_HINT_RANGE, "0,256,1"));
 }
 
 bool OScriptNodeInstantiateScene::_get(const StringName& p_name, Variant& r_value) const {
     if (p_name.match("scene")) {
         r_value = _scene;
         return true;
+    } else if (p_name.match("pool_size")) {
+        r_value = _pool_size;
+        return true;
     }
     return false;
 }
@@ -39,6 +43,10 @@ bool OScriptNodeInstantiateScene::_set(const StringName& p_name, const Variant&
         _scene = p_value;
         _notify_pins_changed();
         return true;
+    } else if (p_name.match("pool_size")) {
+        _pool_size = MAX(0, static_cast<int>(p_value));
+        emit_changed();
+        return true;
     }
     return false;
 }
@@ -23,6 +23,7 @@ class OScriptNodeInstantiateScene : public OScriptNode {
     ORCHESTRATOR_NODE_CLASS(OScriptNodeInstantiateScene, OScriptNode);
 
     String _scene;
+    int _pool_size = 0; // Released instances kept for reuse, 0 disables pooling
 
 protected:
     static void _bind_methods() { }
@@ -56,4 +57,5 @@ public:
     //~ End OScriptNode Interface
 
     String get_scene_path() const { return _scene; }
+    int get_pool_size() const { return _pool_size; }
 };
@@ -31,35 +31,97 @@
 
 #include <godot_cpp/classes/os.hpp>
 
-void Orchestration::ConnectionCache::_rebuild() const {
-    if (!_dirty) {
+template <typename K>
+void Orchestration::ConnectionCache::_add(HashMap<K, LocalVector<uint64_t>>& r_map, const K& p_key, uint64_t p_id) {
+    LocalVector<uint64_t>& ids = r_map[p_key];
+
+    // Runs are short, keep them in connection order like the connection set
+    uint32_t position = ids.size();
+    while (position > 0 && ids[position - 1] > p_id) {
+        position--;
+    }
+    ids.insert(position, p_id);
+}
+
+template <typename K>
+void Orchestration::ConnectionCache::_remove(HashMap<K, LocalVector<uint64_t>>& r_map, const K& p_key, uint64_t p_id) {
+    typename HashMap<K, LocalVector<uint64_t>>::Iterator E = r_map.find(p_key);
+    if (!E) {
         return;
     }
 
-    _input_connections.clear();
-    _output_connections.clear();
+    const int64_t position = E->value.find(p_id);
+    if (position >= 0) {
+        E->value.remove_at(position);
+    }
+
+    if (E->value.is_empty()) {
+        r_map.remove(E);
+    }
+}
+
+template <typename K>
+OScriptConnectionSpan Orchestration::ConnectionCache::_span(const HashMap<K, LocalVector<uint64_t>>& p_map, const K& p_key) {
+    const LocalVector<uint64_t>* ids = p_map.getptr(p_key);
+    if (!ids) {
+        return {};
+    }
 
-    for (const OScriptConnection& E : _connections) {
-        const uint32_t from = key(E.from_node, E.from_port);
-        const uint32_t to = key(E.to_node, E.to_port);
-        _output_connections[from].push_back(to);
-        _input_connections[to].push_back(from);
+    OScriptConnectionSpan span;
+    span.ids = ids->ptr();
+    span.count = ids->size();
+    return span;
+}
+
+uint64_t Orchestration::ConnectionCache::key(int p_node_id, int p_pin_index) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(p_node_id)) << 32) | static_cast<uint32_t>(p_pin_index);
+}
+
+void Orchestration::ConnectionCache::insert(const OScriptConnection& p_connection) {
+    if (_connections.has(p_connection)) {
+        return;
     }
 
-    _dirty = false;
+    _connections.insert(p_connection);
+
+    _add(_output_connections, key(p_connection.from_node, p_connection.from_port), p_connection.id);
+    _add(_input_connections, key(p_connection.to_node, p_connection.to_port), p_connection.id);
+    _add(_node_connections, static_cast<int>(p_connection.from_node), p_connection.id);
+    if (p_connection.to_node != p_connection.from_node) {
+        _add(_node_connections, static_cast<int>(p_connection.to_node), p_connection.id);
+    }
 }
 
-uint32_t Orchestration::ConnectionCache::key(int p_node_id, int p_pin_index) {
-    DEV_ASSERT(p_pin_index <= 0xFF);
-    return (static_cast<uint32_t>(p_node_id) << 8) | static_cast<uint32_t>(p_pin_index);
+void Orchestration::ConnectionCache::erase(const OScriptConnection& p_connection) {
+    if (!_connections.erase(p_connection)) {
+        return;
+    }
+
+    _remove(_output_connections, key(p_connection.from_node, p_connection.from_port), p_connection.id);
+    _remove(_input_connections, key(p_connection.to_node, p_connection.to_port), p_connection.id);
+    _remove(_node_connections, static_cast<int>(p_connection.from_node), p_connection.id);
+    if (p_connection.to_node != p_connection.from_node) {
+        _remove(_node_connections, static_cast<int>(p_connection.to_node), p_connection.id);
+    }
 }
 
-int Orchestration::ConnectionCache::node_from_key(uint32_t p_key) {
-    return static_cast<int>(p_key >> 8);
+void Orchestration::ConnectionCache::clear() {
+    _connections.clear();
+    _input_connections.clear();
+    _output_connections.clear();
+    _node_connections.clear();
 }
 
-int Orchestration::ConnectionCache::pin_index_from_key(uint32_t p_key) {
-    return static_cast<int>(p_key & 0xFF);
+OScriptConnectionSpan Orchestration::ConnectionCache::inputs(uint64_t p_key) const {
+    return _span(_input_connections, p_key);
+}
+
+OScriptConnectionSpan Orchestration::ConnectionCache::outputs(uint64_t p_key) const {
+    return _span(_output_connections, p_key);
+}
+
+OScriptConnectionSpan Orchestration::ConnectionCache::node(int p_node_id) const {
+    return _span(_node_connections, p_node_id);
 }
 
 TypedArray<OScriptNode> Orchestration::_get_nodes_internal() const {
@@ -101,6 +163,10 @@ void Orchestration::_set_connections_internal(const TypedArray<int>& p_connectio
 
         _connection_cache.insert(connection);
     }
+
+    for (const KeyValue<StringName, Ref<OScriptGraph>>& E : _graphs) {
+        E.value->_invalidate_connections();
+    }
 }
 
 TypedArray<OScriptGraph> Orchestration::_get_graphs_internal() const {
@@ -226,7 +292,7 @@ void Orchestration::_fix_orphans() {
 
             WARN_PRINT(vformat("Removing orphan connection for " + C.to_string() + ", either the source or target node no longer exists." + extra));
 
-            _connection_cache.erase(C);
+            _erase_connection(C);
         }
     }
 }
@@ -241,7 +307,7 @@ void Orchestration::_connect_nodes(int p_source_id, int p_source_port, int p_tar
     connection.to_port = p_target_port;
 
     ERR_FAIL_COND_MSG(_connection_cache.has(connection), "A connection already exists: " + connection.to_string());
-    _connection_cache.insert(connection);
+    _insert_connection(connection);
 
     emit_signal("connections_changed");
 }
@@ -256,7 +322,7 @@ void Orchestration::_disconnect_nodes(int p_source_id, int p_source_port, int p_
     connection.to_port = p_target_port;
 
     ERR_FAIL_COND_MSG(!_connection_cache.has(connection), "Cannot remove non-existant connection: " + connection.to_string());
-    _connection_cache.erase(connection);
+    _erase_connection(connection);
 
     // Clean-up graph knots for the connection
     for (const KeyValue<StringName, Ref<OScriptGraph>>& E : _graphs) {
@@ -509,7 +575,7 @@ void Orchestration::remove_node(int p_node_id) {
     if (!removals.is_empty()) {
         ERR_PRINT("Node still has remaining connects, cleaning them up");
         while (!removals.is_empty()) {
-            _connection_cache.erase(removals.front()->get());
+            _erase_connection(removals.front()->get());
             removals.pop_front();
         }
     }
@@ -521,6 +587,24 @@ void Orchestration::remove_node(int p_node_id) {
     _nodes.erase(p_node_id);
 }
 
+void Orchestration::_insert_connection(const OScriptConnection& p_connection) {
+    _connection_cache.insert(p_connection);
+    for (const KeyValue<StringName, Ref<OScriptGraph>>& E : _graphs) {
+        E.value->_connection_added(p_connection);
+    }
+}
+
+void Orchestration::_erase_connection(const OScriptConnection& p_connection) {
+    _connection_cache.erase(p_connection);
+    for (const KeyValue<StringName, Ref<OScriptGraph>>& E : _graphs) {
+        E.value->_connection_removed(p_connection);
+    }
+}
+
+OScriptConnectionSpan Orchestration::_get_node_connections(int p_node_id) const {
+    return _connection_cache.node(p_node_id);
+}
+
 Ref<OScriptNode> Orchestration::get_node(int p_node_id) const {
     ERR_FAIL_COND_V_MSG(!_nodes.has(p_node_id), nullptr, "No node exists with the specified ID: " + itos(p_node_id));
     return _nodes[p_node_id];
@@ -553,19 +637,16 @@ Vector<Ref<OScriptNodePin>> Orchestration::get_connections(const OScriptNodePin*
     }
 
     const bool input = p_pin->is_input();
-    const uint32_t key = ConnectionCache::key(node->get_id(), p_pin->get_pin_index());
-
-    const Vector<uint32_t>* others = input ? _connection_cache.inputs(key) : _connection_cache.outputs(key);
-    if (!others) {
+    const OScriptConnectionSpan others = get_connections(node->get_id(), p_pin->get_pin_index(), p_pin->get_direction());
+    if (others.is_empty()) {
         return {};
     }
 
-    const EPinDirection other_dir = input ? PD_Output : PD_Input;
     Vector<Ref<OScriptNodePin>> results;
-    for (uint32_t endpoint : *others) {
-        const Ref<OScriptNode> other = get_node(ConnectionCache::node_from_key(endpoint));
+    for (const OScriptConnection& E : others) {
+        const Ref<OScriptNode> other = get_node(input ? E.from_node : E.to_node);
         if (other.is_valid()) {
-            const Ref<OScriptNodePin> other_pin = other->find_pin(ConnectionCache::pin_index_from_key(endpoint), other_dir);
+            const Ref<OScriptNodePin> other_pin = input ? other->find_pin(E.from_port, PD_Output) : other->find_pin(E.to_port, PD_Input);
             if (other_pin.is_valid()) {
                 results.push_back(other_pin);
             }
@@ -574,6 +655,11 @@ Vector<Ref<OScriptNodePin>> Orchestration::get_connections(const OScriptNodePin*
     return results;
 }
 
+OScriptConnectionSpan Orchestration::get_connections(int p_node_id, int p_pin_index, EPinDirection p_direction) const {
+    const uint64_t key = ConnectionCache::key(p_node_id, p_pin_index);
+    return p_direction == PD_Input ? _connection_cache.inputs(key) : _connection_cache.outputs(key);
+}
+
 void Orchestration::adjust_connections(const OScriptNode* p_node, int p_offset, int p_adjustment, EPinDirection p_dir) {
     struct ConnectionData {
         OScriptConnection existing;
@@ -611,12 +697,12 @@ void Orchestration::adjust_connections(const OScriptNode* p_node, int p_offset,
     // Now that the data set has been cached, the next phase must be done in 2 steps
     // First remove the old entries from the RBSet
     for (const ConnectionData& cd : data) {
-        _connection_cache.erase(cd.existing);
+        _erase_connection(cd.existing);
     }
 
     // Next add the new entries to the RBSet
     for (const ConnectionData& cd : data) {
-        _connection_cache.insert(cd.mutated);
+        _insert_connection(cd.mutated);
     }
 
     emit_signal("connections_changed");
@@ -632,9 +718,7 @@ bool Orchestration::has_connections(const OScriptNodePin* p_pin) const {
         return false;
     }
 
-    const uint32_t key = ConnectionCache::key(node->get_id(), p_pin->get_pin_index());
-    const Vector<uint32_t>* others = p_pin->is_input() ? _connection_cache.inputs(key) : _connection_cache.outputs(key);
-    return others != nullptr && !others->is_empty();
+    return !get_connections(node->get_id(), p_pin->get_pin_index(), p_pin->get_direction()).is_empty();
 }
 
 Ref<OScriptNodePin> Orchestration::get_single_connection(const OScriptNodePin* p_pin) const {
@@ -648,20 +732,17 @@ Ref<OScriptNodePin> Orchestration::get_single_connection(const OScriptNodePin* p
     }
 
     const bool input = p_pin->is_input();
-    const uint32_t key = ConnectionCache::key(node->get_id(), p_pin->get_pin_index());
-
-    const Vector<uint32_t>* others = input ? _connection_cache.inputs(key) : _connection_cache.outputs(key);
-    if (!others) {
+    const OScriptConnectionSpan others = get_connections(node->get_id(), p_pin->get_pin_index(), p_pin->get_direction());
+    if (others.is_empty()) {
         return {};
     }
 
-    const EPinDirection other_dir = input ? PD_Output : PD_Input;
     Ref<OScriptNodePin> found;
     int valid = 0;
-    for (uint32_t endpoint : *others) {
-        const Ref<OScriptNode> other = get_node(ConnectionCache::node_from_key(endpoint));
+    for (const OScriptConnection& E : others) {
+        const Ref<OScriptNode> other = get_node(input ? E.from_node : E.to_node);
         if (other.is_valid()) {
-            const Ref<OScriptNodePin> other_pin = other->find_pin(ConnectionCache::pin_index_from_key(endpoint), other_dir);
+            const Ref<OScriptNodePin> other_pin = input ? other->find_pin(E.from_port, PD_Output) : other->find_pin(E.to_port, PD_Input);
             if (other_pin.is_valid()) {
                 // More than one valid endpoint: caller semantics require an invalid result.
                 if (++valid > 1) {
@@ -1426,6 +1507,18 @@ void Orchestration::copy_state(const Ref<Orchestration>& p_other) {
     }
 }
 
+Ref<Orchestration> Orchestration::create_snapshot() const {
+    Ref<Orchestration> snapshot = duplicate(true);
+    ERR_FAIL_COND_V_MSG(snapshot.is_null(), {}, "Failed to create orchestration snapshot");
+
+    // Neither is a stored property, the version avoids re-running upgrades on the copy.
+    snapshot->_self = _self;
+    snapshot->_version = _version;
+    snapshot->post_initialize();
+
+    return snapshot;
+}
+
 void Orchestration::_bind_methods() {
     ClassDB::bind_method(D_METHOD("_set_base_type", "p_base_type"), &Orchestration::set_base_type);
     ClassDB::bind_method(D_METHOD("_get_base_type"), &Orchestration::get_base_type);
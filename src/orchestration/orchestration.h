@@ -24,6 +24,7 @@
 #include "orchestration/variable.h"
 
 #include <godot_cpp/classes/texture2d.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/templates/rb_set.hpp>
 
 using namespace godot;
@@ -60,33 +61,40 @@ class Orchestration : public Resource {
     friend class OScriptCache;
     friend class OScriptLanguage;
 
-    // Utility struct that maintains the connections and auxillery lookups
+    // Utility struct that maintains the connections and their adjacency by pin and by node. The
+    // adjacency is updated as connections are inserted and erased, and each run of connection ids
+    // is kept in connection order, so it can be handed out as an OScriptConnectionSpan.
     struct ConnectionCache {
     private:
         // All connections
         RBSet<OScriptConnection> _connections;
-        // Connections [to_node,to_port] to [from_node,from_port]
-        mutable HashMap<uint32_t, Vector<uint32_t>> _input_connections;
-        // Connections [from_node,from_port] to [to_node,to_port]
-        mutable HashMap<uint32_t, Vector<uint32_t>> _output_connections;
-        mutable bool _dirty = false;
-
-        void _rebuild() const;
+        // Connections by the [to_node,to_port] pin key
+        HashMap<uint64_t, LocalVector<uint64_t>> _input_connections;
+        // Connections by the [from_node,from_port] pin key
+        HashMap<uint64_t, LocalVector<uint64_t>> _output_connections;
+        // Connections by either of their nodes
+        HashMap<int, LocalVector<uint64_t>> _node_connections;
+
+        template <typename K>
+        static void _add(HashMap<K, LocalVector<uint64_t>>& r_map, const K& p_key, uint64_t p_id);
+        template <typename K>
+        static void _remove(HashMap<K, LocalVector<uint64_t>>& r_map, const K& p_key, uint64_t p_id);
+        template <typename K>
+        static OScriptConnectionSpan _span(const HashMap<K, LocalVector<uint64_t>>& p_map, const K& p_key);
 
     public:
-        static uint32_t key(int p_node_id, int p_pin_index);
-        static int node_from_key(uint32_t p_key);
-        static int pin_index_from_key(uint32_t p_key);
+        static uint64_t key(int p_node_id, int p_pin_index);
 
         bool has(const OScriptConnection& p_connection) const { return _connections.has(p_connection); }
 
-        void insert(const OScriptConnection& p_connection) { _connections.insert(p_connection); _dirty = true; }
-        void erase(const OScriptConnection& p_connection) { _connections.erase(p_connection); _dirty = true; }
-        void clear() { _connections.clear(); _dirty = true; }
+        void insert(const OScriptConnection& p_connection);
+        void erase(const OScriptConnection& p_connection);
+        void clear();
 
         const RBSet<OScriptConnection>& all() const { return _connections; }
-        const Vector<uint32_t>* inputs(uint32_t p_key) const { _rebuild(); return _input_connections.getptr(p_key); }
-        const Vector<uint32_t>* outputs(uint32_t p_key) const { _rebuild(); return _output_connections.getptr(p_key); }
+        OScriptConnectionSpan inputs(uint64_t p_key) const;
+        OScriptConnectionSpan outputs(uint64_t p_key) const;
+        OScriptConnectionSpan node(int p_node_id) const;
     };
 
     OrchestrationType _type;                               //! The orchestration type
@@ -96,7 +104,7 @@ class Orchestration : public Resource {
     StringName _base_type;                                 //! The base type of the orchestration
     StringName _global_name;                               //! Global class name for script, e.g. `class_name`
     String _icon_path;                                     //! Path to script's custom icon, e.g. `@icon`
-    ConnectionCache _connection_cache;                     //! Connections plus a lazily-built adjacency index
+    ConnectionCache _connection_cache;                     //! Connections plus an incremental adjacency index
     HashMap<int, Ref<OScriptNode>> _nodes;                 //! Map of all nodes within this orchestration
     HashMap<StringName, Ref<OScriptFunction>> _functions;  //! Map of all orchestration functions
     HashMap<StringName, Ref<OScriptVariable>> _variables;  //! Map of all orchestration variables
@@ -137,6 +145,9 @@ protected:
     //~ Begin Internal Connection API
     void _connect_nodes(int p_source_id, int p_source_port, int p_target_id, int p_target_port);
     void _disconnect_nodes(int p_source_id, int p_source_port, int p_target_id, int p_target_port);
+    void _insert_connection(const OScriptConnection& p_connection);
+    void _erase_connection(const OScriptConnection& p_connection);
+    OScriptConnectionSpan _get_node_connections(int p_node_id) const;
     //~ End Internal Connection API
 
     /// Get all unique node ids for a specific node type
@@ -267,6 +278,12 @@ public:
     /// @note this method was left because OScriptNodePin needs this due to an order of operations issue
     void disconnect_nodes(int p_source_id, int p_source_port, int p_target_id, int p_target_port);
     Vector<Ref<OScriptNodePin>> get_connections(const OScriptNodePin* p_pin) const;
+    /// Returns the connections of a pin without resolving endpoint pins or allocating.
+    /// @param p_node_id the node id
+    /// @param p_pin_index the pin index
+    /// @param p_direction the pin direction
+    /// @return the connections, valid until the connections change
+    OScriptConnectionSpan get_connections(int p_node_id, int p_pin_index, EPinDirection p_direction) const;
     void adjust_connections(const OScriptNode* p_node, int p_offset, int p_adjustment, EPinDirection p_dir = PD_MAX);
     /// Returns whether the pin has at least one connection, without resolving endpoint pins.
     bool has_connections(const OScriptNodePin* p_pin) const;
@@ -329,6 +346,12 @@ public:
 
     void copy_state(const Ref<Orchestration>& p_other);
 
+    /// Creates a detached deep copy of the orchestration's stored state. The copy shares no nodes,
+    /// graphs, or members with this orchestration, so it can be read from another thread while
+    /// this orchestration continues to be edited.
+    /// @return the snapshot
+    Ref<Orchestration> create_snapshot() const;
+
     Orchestration();
     ~Orchestration() override = default;
 };
@@ -2954,7 +2954,8 @@ void OScriptAnalyzer::resolve_for(OScriptParser::ForNode* p_for) {
 		if (p_for->list->type == OScriptParser::Node::CALL) {
 			OScriptParser::CallNode* call = static_cast<OScriptParser::CallNode*>(p_for->list);
 			if (call->get_callee_type() == OScriptParser::Node::IDENTIFIER) {
-				if (static_cast<OScriptParser::IdentifierNode*>(call->callee)->name == StringName("range")) {
+				const StringName& callee_name = static_cast<OScriptParser::IdentifierNode*>(call->callee)->name;
+				if (callee_name == StringName("range") || callee_name == StringName("_oscript_internal_range")) {
 					if (call->arguments.is_empty()) {
 						push_error(R"*(Invalid call for "range()" function. Expected at least 1 argument, none given.)*", call);
 					} else if (call->arguments.size() > 3) {
@@ -3711,6 +3712,16 @@ void OScriptAnalyzer::reduce_await(OScriptParser::AwaitNode* p_await) {
         return;
     }
 
+    if (p_await->is_delay) {
+        // The duration is only read by the scheduler, and the delay itself produces no value.
+        reduce_expression(p_await->to_await);
+
+        OScriptParser::DataType await_type;
+        await_type.kind = OScriptParser::DataType::VARIANT;
+        p_await->set_datatype(await_type);
+        return;
+    }
+
     if (p_await->to_await->type == OScriptParser::Node::CALL) {
         reduce_call(static_cast<OScriptParser::CallNode*>(p_await->to_await), true);
     } else {
@@ -4473,8 +4484,12 @@ void OScriptAnalyzer::reduce_get_node(OScriptParser::GetNodeNode* p_get_node) {
     result.kind = OScriptParser::DataType::VARIANT;
 
     if (!ClassDB::is_parent_class(parser->current_class->base_type.native_type, StringName("Node"))) {
-        push_error(vformat(R"*(Cannot use shorthand "get_node()" notation ("%c") on a class that isn't a node.)*",
-            p_get_node->use_dollar ? '$' : '%'), p_get_node);
+        if (p_get_node->use_dollar || p_get_node->full_path.begins_with("%")) {
+            push_error(vformat(R"*(Cannot use shorthand "get_node()" notation ("%c") on a class that isn't a node.)*",
+                p_get_node->use_dollar ? '$' : '%'), p_get_node);
+        } else {
+            push_error(vformat(R"*(Cannot get scene node "%s" on a class that isn't a node.)*", p_get_node->full_path), p_get_node);
+        }
         p_get_node->set_datatype(result);
         return;
     }
@@ -21,6 +21,7 @@
 #include "core/godot/gdextension_compat.h"
 #include "core/godot/method_bind.h"
 #include "core/godot/variant/variant.h"
+#include "script/compiler/bytecode_optimizer.h"
 #include "script/language.h"
 #include "script/script.h"
 
@@ -239,6 +240,16 @@ int OScriptBytecodeGenerator::get_lambda_function_pos(OScriptCompiledFunction* p
     return pos;
 }
 
+int OScriptBytecodeGenerator::get_oscript_function_pos(const StringName& p_function_name) {
+    if (oscript_functions_map.has(p_function_name)) {
+        return oscript_functions_map[p_function_name];
+    }
+
+    const int pos = oscript_functions_map.size();
+    oscript_functions_map[p_function_name] = pos;
+    return pos;
+}
+
 OScriptBytecodeGenerator::CallTarget OScriptBytecodeGenerator::get_call_target(const Address& p_target, Variant::Type p_type) {
     if (p_target.mode == Address::NIL) {
         OScriptDataType type;
@@ -308,6 +319,54 @@ void OScriptBytecodeGenerator::append_op_eval(GDExtensionPtrOperatorEvaluator p_
     opcodes.push_back(get_operation_pos(p_operation));
 }
 
+void OScriptBytecodeGenerator::append_operator_cache() {
+    operator_signature_positions.push_back(opcodes.size());
+    append(OScriptCompiledFunction::OPERATOR_SIGNATURE_UNRESOLVED); // Signature storage.
+    append(operator_signature_positions.size() - 1); // Resolved evaluator storage.
+}
+
+bool OScriptBytecodeGenerator::get_typed_operator(Variant::Operator p_operator, Variant::Type p_left, Variant::Type p_right, OScriptCompiledFunction::Opcode& r_opcode) {
+    #define TYPED_OPERATOR(m_operator, m_left, m_right, m_opcode)                                       \
+        if (p_operator == Variant::m_operator && p_left == Variant::m_left && p_right == Variant::m_right) { \
+            r_opcode = OScriptCompiledFunction::m_opcode;                                                 \
+            return true;                                                                                  \
+        }
+
+    TYPED_OPERATOR(OP_ADD, INT, INT, OPCODE_ADD_INT_INT)
+    TYPED_OPERATOR(OP_SUBTRACT, INT, INT, OPCODE_SUB_INT_INT)
+    TYPED_OPERATOR(OP_MULTIPLY, INT, INT, OPCODE_MUL_INT_INT)
+    TYPED_OPERATOR(OP_EQUAL, INT, INT, OPCODE_EQUAL_INT_INT)
+    TYPED_OPERATOR(OP_NOT_EQUAL, INT, INT, OPCODE_NOT_EQUAL_INT_INT)
+    TYPED_OPERATOR(OP_LESS, INT, INT, OPCODE_LESS_INT_INT)
+    TYPED_OPERATOR(OP_LESS_EQUAL, INT, INT, OPCODE_LESS_EQUAL_INT_INT)
+    TYPED_OPERATOR(OP_GREATER, INT, INT, OPCODE_GREATER_INT_INT)
+    TYPED_OPERATOR(OP_GREATER_EQUAL, INT, INT, OPCODE_GREATER_EQUAL_INT_INT)
+
+    TYPED_OPERATOR(OP_ADD, FLOAT, FLOAT, OPCODE_ADD_FLOAT_FLOAT)
+    TYPED_OPERATOR(OP_SUBTRACT, FLOAT, FLOAT, OPCODE_SUB_FLOAT_FLOAT)
+    TYPED_OPERATOR(OP_MULTIPLY, FLOAT, FLOAT, OPCODE_MUL_FLOAT_FLOAT)
+    TYPED_OPERATOR(OP_DIVIDE, FLOAT, FLOAT, OPCODE_DIV_FLOAT_FLOAT)
+    TYPED_OPERATOR(OP_LESS, FLOAT, FLOAT, OPCODE_LESS_FLOAT_FLOAT)
+    TYPED_OPERATOR(OP_LESS_EQUAL, FLOAT, FLOAT, OPCODE_LESS_EQUAL_FLOAT_FLOAT)
+    TYPED_OPERATOR(OP_GREATER, FLOAT, FLOAT, OPCODE_GREATER_FLOAT_FLOAT)
+    TYPED_OPERATOR(OP_GREATER_EQUAL, FLOAT, FLOAT, OPCODE_GREATER_EQUAL_FLOAT_FLOAT)
+
+    TYPED_OPERATOR(OP_ADD, VECTOR2, VECTOR2, OPCODE_ADD_VECTOR2_VECTOR2)
+    TYPED_OPERATOR(OP_SUBTRACT, VECTOR2, VECTOR2, OPCODE_SUB_VECTOR2_VECTOR2)
+    TYPED_OPERATOR(OP_MULTIPLY, VECTOR2, VECTOR2, OPCODE_MUL_VECTOR2_VECTOR2)
+    TYPED_OPERATOR(OP_MULTIPLY, VECTOR2, FLOAT, OPCODE_MUL_VECTOR2_FLOAT)
+    TYPED_OPERATOR(OP_DIVIDE, VECTOR2, FLOAT, OPCODE_DIV_VECTOR2_FLOAT)
+
+    TYPED_OPERATOR(OP_ADD, VECTOR3, VECTOR3, OPCODE_ADD_VECTOR3_VECTOR3)
+    TYPED_OPERATOR(OP_SUBTRACT, VECTOR3, VECTOR3, OPCODE_SUB_VECTOR3_VECTOR3)
+    TYPED_OPERATOR(OP_MULTIPLY, VECTOR3, VECTOR3, OPCODE_MUL_VECTOR3_VECTOR3)
+    TYPED_OPERATOR(OP_MULTIPLY, VECTOR3, FLOAT, OPCODE_MUL_VECTOR3_FLOAT)
+    TYPED_OPERATOR(OP_DIVIDE, VECTOR3, FLOAT, OPCODE_DIV_VECTOR3_FLOAT)
+
+    #undef TYPED_OPERATOR
+    return false;
+}
+
 void OScriptBytecodeGenerator::append(GDExtensionPtrSetter p_setter) {
     opcodes.push_back(get_setter_pos(p_setter));
 }
@@ -460,6 +519,9 @@ uint32_t OScriptBytecodeGenerator::add_temporary(const OScriptDataType& p_type)
     const int slot = pool.front()->get();
     pool.pop_front();
     used_temporaries.push_back(slot);
+
+    // Marks where this use of the slot begins, so that the optimizer can reason about its lifetime.
+    temporaries.write[slot].allocations.push_back(temporaries[slot].bytecode_indices.size());
     return slot;
 }
 
@@ -595,6 +657,32 @@ OScriptCompiledFunction* OScriptBytecodeGenerator::write_end() {
 			function->temporary_slots[stack_index] = temporaries[i].type;
 		}
 	}
+	function->_build_frame_layout();
+
+	if (OScriptLanguage::get_singleton()->should_optimize_bytecode()) {
+		OScriptBytecodeOptimizer optimizer(opcodes);
+		for (const StackSlot& temporary : temporaries) {
+			for (int i = 0; i < temporary.allocations.size(); i++) {
+				const int from = temporary.allocations[i];
+				const int to = i + 1 < temporary.allocations.size() ? temporary.allocations[i + 1] : temporary.bytecode_indices.size();
+				optimizer.add_temporary_uses(temporary.bytecode_indices.slice(from, to));
+			}
+		}
+		optimizer.add_code_positions(&function->default_arguments);
+		optimizer.add_code_positions(&operator_signature_positions);
+		for (int i = 0; i < function->switch_tables.size(); i++) {
+			optimizer.add_code_positions(&function->switch_tables.write[i].targets);
+		}
+
+		#ifdef DEBUG_ENABLED
+		const Vector<int> unoptimized_code = opcodes;
+		if (optimizer.optimize()) {
+			function->unoptimized_code = unoptimized_code;
+		}
+		#else
+		optimizer.optimize();
+		#endif
+	}
 
 	if (constant_map.size()) {
 		function->constant_count = constant_map.size();
@@ -795,9 +883,59 @@ OScriptCompiledFunction* OScriptBytecodeGenerator::write_end() {
 		function->lambdas_count = 0;
 	}
 
+	if (oscript_functions_map.size()) {
+		// Pointers are resolved when the script is linked, see OScriptCompiler::link_oscript_functions.
+		function->oscript_function_names.resize(oscript_functions_map.size());
+		function->oscript_functions.resize(oscript_functions_map.size());
+		function->oscript_functions_ptr = function->oscript_functions.ptrw();
+		function->oscript_functions_count = oscript_functions_map.size();
+		for (const KeyValue<StringName, int>& E : oscript_functions_map) {
+			function->oscript_function_names.write[E.value] = E.key;
+			function->oscript_functions.write[E.value] = nullptr;
+		}
+	} else {
+		function->oscript_functions_ptr = nullptr;
+		function->oscript_functions_count = 0;
+	}
+
+	if (member_caches_count) {
+		// Entries are resolved by the VM on first execution of each member access.
+		function->member_caches.resize(member_caches_count);
+		function->member_caches_ptr = function->member_caches.ptrw();
+		function->member_caches_count = member_caches_count;
+		for (int i = 0; i < member_caches_count; i++) {
+			function->member_caches_ptr[i] = nullptr;
+		}
+	} else {
+		function->member_caches_ptr = nullptr;
+		function->member_caches_count = 0;
+	}
+
+	if (operator_signature_positions.size()) {
+		function->operator_caches.resize(operator_signature_positions.size());
+		function->operator_caches_ptr = function->operator_caches.ptrw();
+		function->operator_caches_count = operator_signature_positions.size();
+		for (int i = 0; i < function->operator_caches_count; i++) {
+			function->operator_caches_ptr[i].signature_pos = operator_signature_positions[i];
+		}
+	} else {
+		function->operator_caches_ptr = nullptr;
+		function->operator_caches_count = 0;
+	}
+
+	function->switch_tables_count = function->switch_tables.size();
+	function->switch_tables_ptr = function->switch_tables_count ? function->switch_tables.ptr() : nullptr;
+
 	if (OScriptLanguage::get_singleton()->should_track_locals()) {
 		function->stack_debug = stack_debug;
 	}
+	for (int node_id : script_nodes) {
+		function->script_nodes.push_back(node_id);
+	}
+	function->script_nodes.sort();
+    #ifdef DEBUG_ENABLED
+	function->_init_node_profiles();
+    #endif
 	function->stack_size = OScriptCompiledFunction::FIXED_ADDRESSES_MAX + max_locals + temporaries.size();
 	function->instruction_arg_size = instr_args_max;
 
@@ -809,6 +947,13 @@ OScriptCompiledFunction* OScriptBytecodeGenerator::write_end() {
 	function->constructors_names = constructors_names;
 	function->utilities_names = utilities_names;
 	function->os_utilities_names = os_utilities_names;
+	function->methods_names = methods_names;
+    #endif
+
+    #ifdef TOOLS_ENABLED
+	for (int i = 0; i < OScriptCompiledFunction::POINTER_TABLE_MAX; i++) {
+		function->pointer_signatures[i] = pointer_signatures[i];
+	}
     #endif
 
 	ended = true;
@@ -1000,36 +1145,19 @@ void OScriptBytecodeGenerator::write_unary_operator(const Address& p_target, Var
         // #ifdef DEBUG_ENABLED
         // add_debug_name(operator_names, get_operation_pos(op_func), VariantUtils::get_operator_name(p_operator));
         // #endif
+        // #ifdef TOOLS_ENABLED
+        // add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_OPERATORS, get_operation_pos(op_func), { p_operand.type.builtin_type, Variant::NIL, p_operator });
+        // #endif
         // return;
     }
 
-    // todo:
-    //  This is intentionally used to short-circuit the logic below.
-    //  See script_vm OPCODE_OPERATOR_EVALUATE opcode handler for details why.
-    if (true) {
-        append_opcode(OScriptCompiledFunction::OPCODE_OPERATOR_EVALUATE);
-        append(p_operand);
-        append(Address());
-        append(p_target);
-        append(p_operator);
-        #ifdef DEBUG_ENABLED
-        add_debug_name(operator_names, p_operator, GDE::Variant::get_operator_name(p_operator));
-        #endif
-        return;
-    }
-
     // No specific types, perform variant evaluation.
     append_opcode(OScriptCompiledFunction::OPCODE_OPERATOR);
     append(p_operand);
     append(Address());
     append(p_target);
     append(p_operator);
-    append(0); // Signature storage.
-    append(0); // Return type storage.
-    constexpr int _pointer_size = sizeof(GDExtensionPtrOperatorEvaluator) / sizeof(*(opcodes.ptr()));
-    for (int i = 0; i < _pointer_size; i++) {
-        append(0); // Space for function pointer.
-    }
+    append_operator_cache();
 }
 
 void OScriptBytecodeGenerator::write_binary_operator(const Address& p_target, Variant::Operator p_operator, const Address& p_left, const Address& p_right) {
@@ -1055,21 +1183,11 @@ void OScriptBytecodeGenerator::write_binary_operator(const Address& p_target, Va
 		}
 	}
 
-    // todo:
-    //  This is intentionally used to short-circuit the logic below.
-    //  See script_vm OPCODE_OPERATOR_EVALUATE opcode handler for details why.
-    if (true) {
-        append_opcode(OScriptCompiledFunction::OPCODE_OPERATOR_EVALUATE);
-        append(p_left);
-        append(p_right);
-        append(p_target);
-        append(p_operator);
-        #ifdef DEBUG_ENABLED
-        add_debug_name(operator_names, p_operator, GDE::Variant::get_operator_name(p_operator));
-        #endif
-        return;
-    }
-
+	// todo:
+	//  GDExtension cannot yet resolve OPCODE_OPERATOR_VALIDATED evaluators at compile time, see the
+	//  script_vm OPCODE_OPERATOR_EVALUATE handler. Common math on proven types uses a typed opcode,
+	//  other typed operands fall through to OPCODE_OPERATOR, which resolves a validated evaluator on
+	//  first execution.
 	if (valid) {
 		if (p_target.mode == Address::TEMPORARY) {
 			Variant::Type result_type = GDE::Variant::get_operator_return_type(p_operator, p_left.type.builtin_type, p_right.type.builtin_type);
@@ -1079,6 +1197,15 @@ void OScriptBytecodeGenerator::write_binary_operator(const Address& p_target, Va
 			}
 		}
 
+		OScriptCompiledFunction::Opcode typed_opcode;
+		if (get_typed_operator(p_operator, p_left.type.builtin_type, p_right.type.builtin_type, typed_opcode)) {
+			append_opcode(typed_opcode);
+			append(p_left);
+			append(p_right);
+			append(p_target);
+			return;
+		}
+
 		// Gather specific operator.
 	 //    GDExtensionPtrOperatorEvaluator op_func = VariantUtils::get_validated_operator_evaluator(p_operator, p_left.type.builtin_type, p_right.type.builtin_type);
 		// append_opcode(OScriptCompiledFunction::OPCODE_OPERATOR_VALIDATED);
@@ -1090,6 +1217,9 @@ void OScriptBytecodeGenerator::write_binary_operator(const Address& p_target, Va
   //       #ifdef DEBUG_ENABLED
 		// add_debug_name(operator_names, get_operation_pos(op_func), VariantUtils::get_operator_name(p_operator));
   //       #endif
+		// #ifdef TOOLS_ENABLED
+		// add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_OPERATORS, get_operation_pos(op_func), { p_left.type.builtin_type, p_right.type.builtin_type, p_operator });
+		// #endif
 		// return;
 	}
 
@@ -1099,13 +1229,7 @@ void OScriptBytecodeGenerator::write_binary_operator(const Address& p_target, Va
 	append(p_right);
 	append(p_target);
 	append(p_operator);
-	append(0); // Signature storage.
-	append(0); // Return type storage.
-
-	constexpr int _pointer_size = sizeof(GDExtensionPtrOperatorEvaluator) / sizeof(*(opcodes.ptr()));
-	for (int i = 0; i < _pointer_size; i++) {
-		append(0); // Space for function pointer.
-	}
+	append_operator_cache();
 }
 
 void OScriptBytecodeGenerator::write_type_test(const Address& p_target, const Address& p_source, const OScriptDataType& p_type) {
@@ -1282,6 +1406,9 @@ void OScriptBytecodeGenerator::write_set(const Address& p_target, const Address&
         //             append(p_index);
         //             append(p_source);
         //             append(indexed_setter);
+        //             #ifdef TOOLS_ENABLED
+        //             add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_INDEXED_SETTERS, get_indexed_setter_pos(indexed_setter), { p_target.type.builtin_type });
+        //             #endif
         //             return;
         //         }
         //     }
@@ -1293,6 +1420,9 @@ void OScriptBytecodeGenerator::write_set(const Address& p_target, const Address&
         //         append(p_index);
         //         append(p_source);
         //         append(keyed_setter);
+        //         #ifdef TOOLS_ENABLED
+        //         add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_KEYED_SETTERS, get_keyed_setter_pos(keyed_setter), { p_target.type.builtin_type });
+        //         #endif
         //         return;
         //     }
         // }
@@ -1315,6 +1445,9 @@ void OScriptBytecodeGenerator::write_get(const Address& p_target, const Address&
         //         append(p_index);
         //         append(p_target);
         //         append(indexed_getter);
+        //         #ifdef TOOLS_ENABLED
+        //         add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_INDEXED_GETTERS, get_indexed_getter_pos(indexed_getter), { p_source.type.builtin_type });
+        //         #endif
         //         return;
         //     }
         // }
@@ -1326,6 +1459,9 @@ void OScriptBytecodeGenerator::write_get(const Address& p_target, const Address&
         //     append(p_index);
         //     append(p_target);
         //     append(keyed_getter);
+        //     #ifdef TOOLS_ENABLED
+        //     add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_KEYED_GETTERS, get_keyed_getter_pos(keyed_getter), { p_source.type.builtin_type });
+        //     #endif
         //     return;
         // }
     }
@@ -1348,6 +1484,9 @@ void OScriptBytecodeGenerator::write_set_named(const Address& p_target, const St
         //     #ifdef DEBUG_ENABLED
         //     add_debug_name(setter_names, get_setter_pos(setter), p_name);
         //     #endif
+        //     #ifdef TOOLS_ENABLED
+        //     add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_SETTERS, get_setter_pos(setter), { p_target.type.builtin_type, Variant::NIL, 0, p_name });
+        //     #endif
         //     return;
         // }
     }
@@ -1370,6 +1509,9 @@ void OScriptBytecodeGenerator::write_get_named(const Address& p_target, const St
         //     #ifdef DEBUG_ENABLED
         //     add_debug_name(getter_names, get_getter_pos(getter), p_name);
         //     #endif
+        //     #ifdef TOOLS_ENABLED
+        //     add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_GETTERS, get_getter_pos(getter), { p_source.type.builtin_type, Variant::NIL, 0, p_name });
+        //     #endif
         //     return;
         // }
     }
@@ -1384,12 +1526,14 @@ void OScriptBytecodeGenerator::write_set_member(const Address& p_value, const St
     append_opcode(OScriptCompiledFunction::OPCODE_SET_MEMBER);
     append(p_value);
     append(p_name);
+    append(member_caches_count++);
 }
 
 void OScriptBytecodeGenerator::write_get_member(const Address& p_target, const StringName& p_name) {
     append_opcode(OScriptCompiledFunction::OPCODE_GET_MEMBER);
     append(p_target);
     append(p_name);
+    append(member_caches_count++);
 }
 
 void OScriptBytecodeGenerator::write_set_static_variable(const Address& p_value, const Address& p_class, int p_index) {
@@ -1406,6 +1550,13 @@ void OScriptBytecodeGenerator::write_get_static_variable(const Address& p_target
     append(p_index);
 }
 
+void OScriptBytecodeGenerator::write_get_scene_node(const Address& p_target, const Address& p_path, int p_slot) {
+    append_opcode(OScriptCompiledFunction::OPCODE_GET_SCENE_NODE);
+    append(p_target);
+    append(p_path);
+    append(p_slot);
+}
+
 void OScriptBytecodeGenerator::write_assign(const Address& p_target, const Address& p_source) {
     // See https://github.com/godotengine/godot-cpp/pull/1960
     if (p_target.mode == p_source.mode && p_target.address == p_source.address) {
@@ -1765,6 +1916,9 @@ void OScriptBytecodeGenerator::write_call_builtin_type(const Address& p_target,
     #ifdef DEBUG_ENABLED
     add_debug_name(builtin_methods_names, get_builtin_method_pos(ptr), p_method);
     #endif
+    #ifdef TOOLS_ENABLED
+    add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_BUILTIN_METHODS, get_builtin_method_pos(ptr), { p_type, Variant::NIL, 0, p_method, hash });
+    #endif
 }
 
 void OScriptBytecodeGenerator::write_call_builtin_type(const Address& p_target, const Address& p_base, Variant::Type p_type, const StringName& p_method, const Vector<Address>& p_arguments) {
@@ -1789,9 +1943,13 @@ void OScriptBytecodeGenerator::write_call_native_static(const Address& p_target,
     append(method);
     append(p_arguments.size());
     ct.cleanup();
+
+    #ifdef DEBUG_ENABLED
+    add_debug_name(methods_names, get_method_bind_pos(method), String(p_class) + "::" + String(p_method));
+    #endif
 }
 
-void OScriptBytecodeGenerator::write_call_native_static_validated(const Address& p_target, MethodBind* p_method, const Vector<Address>& p_arguments) {
+void OScriptBytecodeGenerator::write_call_native_static_validated(const Address& p_target, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) {
     Variant::Type return_type = Variant::NIL;
     bool has_return = p_method->has_return();
 
@@ -1821,9 +1979,13 @@ void OScriptBytecodeGenerator::write_call_native_static_validated(const Address&
     append(p_arguments.size());
     append(p_method);
     ct.cleanup();
+
+    #ifdef DEBUG_ENABLED
+    add_debug_name(methods_names, get_method_bind_pos(p_method), String(p_class) + "::" + String(p_method_name));
+    #endif
 }
 
-void OScriptBytecodeGenerator::write_call_method_bind(const Address& p_target, const Address& p_base, MethodBind* p_method, const Vector<Address>& p_arguments) {
+void OScriptBytecodeGenerator::write_call_method_bind(const Address& p_target, const Address& p_base, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) {
     append_opcode_and_argcount(p_target.mode == Address::NIL ? OScriptCompiledFunction::OPCODE_CALL_METHOD_BIND : OScriptCompiledFunction::OPCODE_CALL_METHOD_BIND_RET, 2 + p_arguments.size());
 
     for (int i = 0; i < p_arguments.size(); i++) {
@@ -1836,9 +1998,13 @@ void OScriptBytecodeGenerator::write_call_method_bind(const Address& p_target, c
     append(p_arguments.size());
     append(p_method);
     ct.cleanup();
+
+    #ifdef DEBUG_ENABLED
+    add_debug_name(methods_names, get_method_bind_pos(p_method), String(p_class) + "::" + String(p_method_name));
+    #endif
 }
 
-void OScriptBytecodeGenerator::write_call_method_bind_validated(const Address& p_target, const Address& p_base, MethodBind* p_method, const Vector<Address>& p_arguments) {
+void OScriptBytecodeGenerator::write_call_method_bind_validated(const Address& p_target, const Address& p_base, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) {
     Variant::Type return_type = Variant::NIL;
     bool has_return = p_method->has_return();
 
@@ -1870,6 +2036,10 @@ void OScriptBytecodeGenerator::write_call_method_bind_validated(const Address& p
     append(p_arguments.size());
     append(p_method);
     ct.cleanup();
+
+    #ifdef DEBUG_ENABLED
+    add_debug_name(methods_names, get_method_bind_pos(p_method), String(p_class) + "::" + String(p_method_name));
+    #endif
 }
 
 void OScriptBytecodeGenerator::write_call_self(const Address& p_target, const StringName& p_function_name, const Vector<Address>& p_arguments) {
@@ -1900,6 +2070,24 @@ void OScriptBytecodeGenerator::write_call_self_async(const Address& p_target, co
     ct.cleanup();
 }
 
+void OScriptBytecodeGenerator::write_call_oscript_function(const Address& p_target, const StringName& p_function_name, const Vector<Address>& p_arguments) {
+    append_opcode_and_argcount(p_target.mode == Address::NIL
+        ? OScriptCompiledFunction::OPCODE_CALL_OSCRIPT_FUNCTION
+        : OScriptCompiledFunction::OPCODE_CALL_OSCRIPT_FUNCTION_RETURN,
+        1 + p_arguments.size());
+
+    for (int i = 0; i < p_arguments.size(); i++) {
+        append(p_arguments[i]);
+    }
+
+    CallTarget ct = get_call_target(p_target);
+    append(ct.target);
+    append(p_arguments.size());
+    append(p_function_name);
+    append(get_oscript_function_pos(p_function_name));
+    ct.cleanup();
+}
+
 void OScriptBytecodeGenerator::write_call_script_function(const Address& p_target, const Address& p_base, const StringName& p_function_name, const Vector<Address>& p_arguments) {
     append_opcode_and_argcount(p_target.mode == Address::NIL ? OScriptCompiledFunction::OPCODE_CALL : OScriptCompiledFunction::OPCODE_CALL_RETURN, 2 + p_arguments.size());
     for (int i = 0; i < p_arguments.size(); i++) {
@@ -1979,6 +2167,9 @@ void OScriptBytecodeGenerator::write_construct(const Address& p_target, Variant:
         //     #ifdef DEBUG_ENABLED
         //     add_debug_name(constructors_names, get_constructor_pos(ctor), Variant::get_type_name(p_type));
         //     #endif
+        //     #ifdef TOOLS_ENABLED
+        //     add_pointer_signature(OScriptCompiledFunction::POINTER_TABLE_CONSTRUCTORS, get_constructor_pos(ctor), { p_type, Variant::NIL, valid_constructor });
+        //     #endif
         //
         //     return;
         // }
@@ -2060,6 +2251,13 @@ void OScriptBytecodeGenerator::write_await(const Address& p_target, const Addres
     append(p_target);
 }
 
+void OScriptBytecodeGenerator::write_await_delay(const Address& p_target, const Address& p_duration) {
+    append_opcode(OScriptCompiledFunction::OPCODE_AWAIT_DELAY);
+    append(p_duration);
+    append_opcode(OScriptCompiledFunction::OPCODE_AWAIT_RESUME);
+    append(p_target);
+}
+
 void OScriptBytecodeGenerator::write_if(const Address& p_condition) {
     append_opcode(OScriptCompiledFunction::OPCODE_JUMP_IF_NOT);
     append(p_condition);
@@ -2094,6 +2292,61 @@ void OScriptBytecodeGenerator::write_end_jump_if_shared() {
     if_jmp_addrs.pop_back();
 }
 
+void OScriptBytecodeGenerator::write_switch(const Address& p_value, const Vector<Variant>& p_branch_values) {
+    OScriptCompiledFunction::SwitchTable table;
+    table.targets.resize(p_branch_values.size() + 1);
+    table.targets.fill(0);
+
+    // A nil value marks the wildcard branch, which makes all branches after it unreachable.
+    for (int i = 0; i < p_branch_values.size(); i++) {
+        const Variant& value = p_branch_values[i];
+        if (value.get_type() == Variant::NIL) {
+            table.default_branch = i;
+            break;
+        }
+        table.type = value.get_type() == Variant::INT ? Variant::INT : Variant::STRING;
+        table.values.push_back(value);
+        table.value_branches.push_back(i);
+    }
+    table.build();
+
+    const int table_index = function->switch_tables.size();
+    function->switch_tables.push_back(table);
+
+    append_opcode(OScriptCompiledFunction::OPCODE_SWITCH);
+    append(p_value);
+    append(table_index);
+
+    switch_tables.push_back(table_index);
+    switch_branches.push_back(-1);
+    switch_end_jmp_addrs.push_back(List<int>());
+}
+
+void OScriptBytecodeGenerator::write_switch_branch() {
+    int& branch = switch_branches.back()->get();
+    if (branch >= 0) {
+        append_opcode(OScriptCompiledFunction::OPCODE_JUMP); // Jump from the previous branch to the end.
+        switch_end_jmp_addrs.back()->get().push_back(opcodes.size());
+        append(0); // Jump destination, will be patched.
+    }
+
+    branch++;
+    function->switch_tables.write[switch_tables.back()->get()].targets.write[branch] = opcodes.size();
+}
+
+void OScriptBytecodeGenerator::write_endswitch() {
+    OScriptCompiledFunction::SwitchTable& table = function->switch_tables.write[switch_tables.back()->get()];
+    table.targets.write[table.targets.size() - 1] = opcodes.size();
+
+    for (int jmp_addr : switch_end_jmp_addrs.back()->get()) {
+        patch_jump(jmp_addr);
+    }
+
+    switch_tables.pop_back();
+    switch_branches.pop_back();
+    switch_end_jmp_addrs.pop_back();
+}
+
 void OScriptBytecodeGenerator::start_for(const OScriptDataType& p_iterator_type, const OScriptDataType& p_list_type, bool p_is_range) {
     Address counter(Address::LOCAL_VARIABLE, add_local("@counter_pos", p_iterator_type), p_iterator_type);
 
@@ -2402,6 +2655,7 @@ void OScriptBytecodeGenerator::write_newline(int p_node) {
         append_opcode(OScriptCompiledFunction::OPCODE_SCRIPT_NODE);
         append(p_node);
         current_script_node_id = p_node;
+        script_nodes.insert(p_node);
     }
 }
 
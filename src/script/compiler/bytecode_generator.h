@@ -31,6 +31,7 @@ class OScriptBytecodeGenerator : public OScriptCodeGenerator {
         Variant::Type type = Variant::NIL;
         bool can_contain_object = true;
         Vector<int> bytecode_indices;
+        Vector<int> allocations; // Start of each allocation within bytecode_indices
 
         StackSlot() = default;
         StackSlot(Variant::Type p_type, bool p_can_contain_object) : type(p_type), can_contain_object(p_can_contain_object) {}
@@ -92,6 +93,7 @@ class OScriptBytecodeGenerator : public OScriptCodeGenerator {
 
     int max_locals = 0;
     int current_script_node_id = -1;
+    HashSet<int> script_nodes;
     int instr_args_max = 0;
 
     #ifdef DEBUG_ENABLED
@@ -117,6 +119,9 @@ class OScriptBytecodeGenerator : public OScriptCodeGenerator {
     RBMap<GDExtensionPtrBuiltInMethod, int> built_in_methods_map;
     RBMap<MethodBind*, int> method_bind_map;
     RBMap<OScriptCompiledFunction*, int> lambdas_map;
+    RBMap<StringName, int> oscript_functions_map;
+    int member_caches_count = 0;
+    Vector<int> operator_signature_positions;
 
     #ifdef DEBUG_ENABLED
     // Keep method and property names for pointer and validated operations.
@@ -128,6 +133,7 @@ class OScriptBytecodeGenerator : public OScriptCodeGenerator {
     Vector<String> constructors_names;
     Vector<String> utilities_names;
     Vector<String> os_utilities_names;
+    Vector<String> methods_names;
 
     static void add_debug_name(Vector<String> &vector, int index, const String &name) {
         if (index >= vector.size()) {
@@ -137,7 +143,23 @@ class OScriptBytecodeGenerator : public OScriptCodeGenerator {
     }
     #endif
 
+    #ifdef TOOLS_ENABLED
+    // Keep how pointers of validated operations were resolved, used when writing bytecode images.
+    Vector<OScriptCompiledFunction::PointerSignature> pointer_signatures[OScriptCompiledFunction::POINTER_TABLE_MAX];
+
+    void add_pointer_signature(OScriptCompiledFunction::PointerTable p_table, int p_index, const OScriptCompiledFunction::PointerSignature& p_signature) {
+        Vector<OScriptCompiledFunction::PointerSignature>& signatures = pointer_signatures[p_table];
+        if (p_index >= signatures.size()) {
+            signatures.resize(p_index + 1);
+        }
+        signatures.write[p_index] = p_signature;
+    }
+    #endif
+
     List<int> if_jmp_addrs;
+    List<int> switch_tables;
+    List<int> switch_branches;
+    List<List<int>> switch_end_jmp_addrs;
     List<int> for_jmp_addrs;
     List<Address> for_counter_variables;
     List<Address> for_container_variables;
@@ -176,6 +198,7 @@ class OScriptBytecodeGenerator : public OScriptCodeGenerator {
     int get_builtin_method_pos(GDExtensionPtrBuiltInMethod p_method);
     int get_method_bind_pos(MethodBind* p_method);
     int get_lambda_function_pos(OScriptCompiledFunction* p_function);
+    int get_oscript_function_pos(const StringName& p_function_name);
 
     CallTarget get_call_target(const Address& p_target, Variant::Type p_type = Variant::NIL);
 
@@ -187,6 +210,8 @@ class OScriptBytecodeGenerator : public OScriptCodeGenerator {
     void append(const Address& p_address);
     void append(const StringName& p_name);
     void append_op_eval(GDExtensionPtrOperatorEvaluator p_operation);
+    void append_operator_cache();
+    static bool get_typed_operator(Variant::Operator p_operator, Variant::Type p_left, Variant::Type p_right, OScriptCompiledFunction::Opcode& r_opcode);
     void append(GDExtensionPtrSetter p_setter);
     void append(GDExtensionPtrGetter p_getter);
     void append(GDExtensionPtrIndexedSetter p_setter);
@@ -249,6 +274,7 @@ public:
     void write_get_member(const Address& p_target, const StringName& p_name) override;
     void write_set_static_variable(const Address& p_value, const Address& p_class, int p_index) override;
     void write_get_static_variable(const Address& p_target, const Address& p_class, int p_index) override;
+    void write_get_scene_node(const Address& p_target, const Address& p_path, int p_slot) override;
     void write_assign(const Address& p_target, const Address& p_source) override;
     void write_assign_with_conversion(const Address& p_target, const Address& p_source) override;
     void write_assign_null(const Address& p_target) override;
@@ -267,11 +293,12 @@ public:
     void write_call_builtin_type(const Address& p_target, const Address& p_base, Variant::Type p_type, const StringName& p_method, const Vector<Address>& p_arguments) override;
     void write_call_builtin_type_static(const Address& p_target, Variant::Type p_type, const StringName& p_method, const Vector<Address>& p_arguments) override;
     void write_call_native_static(const Address& p_target, const StringName& p_class, const StringName& p_method, const Vector<Address>& p_arguments) override;
-    void write_call_native_static_validated(const Address& p_target, MethodBind* p_method, const Vector<Address>& p_arguments) override;
-    void write_call_method_bind(const Address& p_target, const Address& p_base, MethodBind* p_method, const Vector<Address>& p_arguments) override;
-    void write_call_method_bind_validated(const Address& p_target, const Address& p_base, MethodBind* p_method, const Vector<Address>& p_arguments) override;
+    void write_call_native_static_validated(const Address& p_target, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) override;
+    void write_call_method_bind(const Address& p_target, const Address& p_base, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) override;
+    void write_call_method_bind_validated(const Address& p_target, const Address& p_base, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) override;
     void write_call_self(const Address& p_target, const StringName& p_function_name, const Vector<Address>& p_arguments) override;
     void write_call_self_async(const Address& p_target, const StringName& p_function_name, const Vector<Address>& p_arguments) override;
+    void write_call_oscript_function(const Address& p_target, const StringName& p_function_name, const Vector<Address>& p_arguments) override;
     void write_call_script_function(const Address& p_target, const Address& p_base, const StringName& p_function_name, const Vector<Address>& p_arguments) override;
     void write_lambda(const Address& p_target, OScriptCompiledFunction* p_function, const Vector<Address>& p_captures, bool p_use_self) override;
     void write_construct(const Address& p_target, Variant::Type p_type, const Vector<Address>& p_arguments) override;
@@ -280,11 +307,15 @@ public:
     void write_construct_dictionary(const Address& p_target, const Vector<Address>& p_arguments) override;
     void write_construct_typed_dictionary(const Address& p_target, const OScriptDataType& p_key_type, const OScriptDataType& p_value_type, const Vector<Address>& p_arguments) override;
     void write_await(const Address& p_target, const Address& p_operand) override;
+    void write_await_delay(const Address& p_target, const Address& p_duration) override;
     void write_if(const Address& p_condition) override;
     void write_else() override;
     void write_endif() override;
     void write_jump_if_shared(const Address& p_value) override;
     void write_end_jump_if_shared() override;
+    void write_switch(const Address& p_value, const Vector<Variant>& p_branch_values) override;
+    void write_switch_branch() override;
+    void write_endswitch() override;
     void start_for(const OScriptDataType& p_iterator_type, const OScriptDataType& p_list_type, bool p_is_range) override;
     void write_for_list_assignment(const Address& p_list) override;
     void write_for_range_assignment(const Address& p_from, const Address& p_to, const Address& p_step) override;
@@ -0,0 +1,1169 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/compiler/bytecode_image.h"
+
+#include "api/extension_db.h"
+#include "common/dictionary_utils.h"
+#include "common/godot_version.h"
+#include "common/version.h"
+#include "core/godot/variant/variant.h"
+#include "script/compiler/compiler.h"
+#include "script/language.h"
+#include "script/script_cache.h"
+#include "script/script_native_class.h"
+#include "script/serialization/format_defs.h"
+#include "script/utility_functions.h"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/resource_loader.hpp>
+
+uint32_t OScriptBytecodeImage::_get_validation_hash() {
+    // Bytecode embeds opcode numbering and the layout of the compiled function tables, so an image is
+    // only valid for the exact Godot build, engine API and Orchestrator version that produced it.
+    const String key = vformat("%s|%d|%s|%d", GodotVersionInfo().string(), ExtensionDB::get_api_hash(),
+        VERSION_FULL_CONFIG, FORMAT_VERSION);
+    return key.hash();
+}
+
+bool OScriptBytecodeImage::_is_plain_value(const Variant& p_value) {
+    switch (p_value.get_type()) {
+        case Variant::OBJECT: {
+            return false;
+        }
+        case Variant::ARRAY: {
+            // Typed containers are not guaranteed to round-trip their element type
+            const Array array = p_value;
+            if (array.is_typed()) {
+                return false;
+            }
+            for (int i = 0; i < array.size(); i++) {
+                if (!_is_plain_value(array[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case Variant::DICTIONARY: {
+            const Dictionary dictionary = p_value;
+            if (dictionary.is_typed()) {
+                return false;
+            }
+            const Array keys = dictionary.keys();
+            for (int i = 0; i < keys.size(); i++) {
+                if (!_is_plain_value(keys[i]) || !_is_plain_value(dictionary[keys[i]])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            return true;
+        }
+    }
+}
+
+bool OScriptBytecodeImage::_is_enabled() {
+    // Images only ship with exported projects, the editor always compiles from source.
+    return !Engine::get_singleton()->is_editor_hint();
+}
+
+void OScriptBytecodeImage::_fail(const String& p_reason) {
+    // The first reason is the one reported, later failures are often a consequence of it
+    if (!_failed) {
+        _fail_reason = p_reason;
+    }
+    _failed = true;
+}
+
+int OScriptBytecodeImage::_get_pointer_table_size(const OScriptCompiledFunction* p_function, int p_table) {
+    switch (p_table) {
+        case OScriptCompiledFunction::POINTER_TABLE_OPERATORS: return p_function->operator_funcs_count;
+        case OScriptCompiledFunction::POINTER_TABLE_SETTERS: return p_function->setters_count;
+        case OScriptCompiledFunction::POINTER_TABLE_GETTERS: return p_function->getters_count;
+        case OScriptCompiledFunction::POINTER_TABLE_KEYED_SETTERS: return p_function->keyed_setters_count;
+        case OScriptCompiledFunction::POINTER_TABLE_KEYED_GETTERS: return p_function->keyed_getters_count;
+        case OScriptCompiledFunction::POINTER_TABLE_INDEXED_SETTERS: return p_function->indexed_setters_count;
+        case OScriptCompiledFunction::POINTER_TABLE_INDEXED_GETTERS: return p_function->indexed_getters_count;
+        case OScriptCompiledFunction::POINTER_TABLE_BUILTIN_METHODS: return p_function->builtin_methods_count;
+        case OScriptCompiledFunction::POINTER_TABLE_CONSTRUCTORS: return p_function->constructors_count;
+        default: return 0;
+    }
+}
+
+#ifdef TOOLS_ENABLED
+void OScriptBytecodeImage::_write_string(const String& p_value) {
+    _buffer->put_utf8_string(p_value);
+}
+
+void OScriptBytecodeImage::_write_script_ref(const Ref<Script>& p_script) {
+    if (p_script.is_null()) {
+        _buffer->put_u8(0);
+        return;
+    }
+
+    const Ref<OScript> oscript = p_script;
+    if (oscript.is_valid()) {
+        _buffer->put_u8(1);
+        _write_string(oscript->get_root_script()->path);
+        _write_string(oscript->fully_qualified_name);
+        return;
+    }
+
+    const String path = p_script->get_path();
+    if (path.is_empty() || path.contains("::")) {
+        // Built-in scripts cannot be resolved by path
+        _fail("it references a built-in script");
+        return;
+    }
+
+    _buffer->put_u8(2);
+    _write_string(path);
+}
+
+void OScriptBytecodeImage::_write_value(const Variant& p_value) {
+    if (p_value.get_type() != Variant::OBJECT) {
+        if (!_is_plain_value(p_value)) {
+            _fail("it holds a typed or object-holding container constant");
+            return;
+        }
+        _buffer->put_u8(VALUE_PLAIN);
+        _buffer->put_var(p_value);
+        return;
+    }
+
+    Object* object = p_value;
+    if (!object) {
+        _buffer->put_u8(VALUE_NULL_OBJECT);
+        return;
+    }
+
+    if (const OScriptNativeClass* native = Object::cast_to<OScriptNativeClass>(object)) {
+        _buffer->put_u8(VALUE_NATIVE_CLASS);
+        _write_string(native->get_name());
+        return;
+    }
+
+    if (Object::cast_to<OScript>(object)) {
+        _buffer->put_u8(VALUE_OSCRIPT);
+        _write_script_ref(Ref<Script>(Object::cast_to<Script>(object)));
+        return;
+    }
+
+    const Resource* resource = Object::cast_to<Resource>(object);
+    if (resource && !resource->get_path().is_empty() && !resource->get_path().contains("::")) {
+        _buffer->put_u8(VALUE_RESOURCE);
+        _write_string(resource->get_path());
+        return;
+    }
+
+    _fail(vformat("it holds a '%s' object that is not saved as a resource", object->get_class()));
+}
+
+void OScriptBytecodeImage::_write_data_type(const OScriptDataType& p_type) {
+    _buffer->put_u8(p_type.kind);
+    _buffer->put_32(p_type.builtin_type);
+    _write_string(p_type.native_type);
+    _write_script_ref(p_type.script_type_ref.is_valid() ? p_type.script_type_ref : Ref<Script>(p_type.script_type));
+
+    _buffer->put_u32(p_type.container_element_types.size());
+    for (const OScriptDataType& element_type : p_type.container_element_types) {
+        _write_data_type(element_type);
+    }
+}
+
+void OScriptBytecodeImage::_write_member_info(const StringName& p_name, const OScript::MemberInfo& p_info) {
+    _write_string(p_name);
+    _buffer->put_32(p_info.index);
+    _write_string(p_info.setter);
+    _write_string(p_info.getter);
+    _write_data_type(p_info.data_type);
+    _write_value(DictionaryUtils::from_property(p_info.property_info));
+}
+
+void OScriptBytecodeImage::_write_function(const OScriptCompiledFunction* p_function) {
+    _write_string(p_function->name);
+    _buffer->put_u8(p_function->_static);
+    _write_value(p_function->rpc_config);
+    _write_data_type(p_function->return_type);
+
+    _buffer->put_u32(p_function->argument_types.size());
+    for (const OScriptDataType& argument_type : p_function->argument_types) {
+        _write_data_type(argument_type);
+    }
+
+    _write_value(DictionaryUtils::from_method(p_function->method_info));
+
+    _buffer->put_32(p_function->initial_node);
+    _buffer->put_32(p_function->argument_count);
+    _buffer->put_32(p_function->vararg_index);
+    _buffer->put_32(p_function->stack_size);
+    _buffer->put_32(p_function->instruction_arg_size);
+
+    _buffer->put_u32(p_function->temporary_slots.size());
+    for (const KeyValue<int, Variant::Type>& E : p_function->temporary_slots) {
+        _buffer->put_32(E.key);
+        _buffer->put_32(E.value);
+    }
+
+    _buffer->put_u32(p_function->stack_debug.size());
+    for (const OScriptCompiledFunction::StackDebug& stack_debug : p_function->stack_debug) {
+        _buffer->put_32(stack_debug.source_node_id);
+        _buffer->put_32(stack_debug.pos);
+        _buffer->put_u8(stack_debug.added);
+        _write_string(stack_debug.identifier);
+    }
+
+    PackedInt32Array code;
+    code.resize(p_function->code.size());
+    for (int i = 0; i < p_function->code.size(); i++) {
+        code[i] = p_function->code[i];
+    }
+
+    // Operator signatures are resolved when executed, the image starts unresolved like freshly compiled code
+    PackedInt32Array operator_signature_positions;
+    operator_signature_positions.resize(p_function->operator_caches_count);
+    for (int i = 0; i < p_function->operator_caches_count; i++) {
+        const int position = p_function->operator_caches_ptr[i].signature_pos;
+        code[position] = OScriptCompiledFunction::OPERATOR_SIGNATURE_UNRESOLVED;
+        operator_signature_positions[i] = position;
+    }
+    _buffer->put_var(code);
+    _buffer->put_var(operator_signature_positions);
+
+    PackedInt32Array default_arguments;
+    default_arguments.resize(p_function->default_arguments.size());
+    for (int i = 0; i < p_function->default_arguments.size(); i++) {
+        default_arguments[i] = p_function->default_arguments[i];
+    }
+    _buffer->put_var(default_arguments);
+
+    PackedInt32Array script_nodes;
+    script_nodes.resize(p_function->script_nodes.size());
+    for (int i = 0; i < p_function->script_nodes.size(); i++) {
+        script_nodes[i] = p_function->script_nodes[i];
+    }
+    _buffer->put_var(script_nodes);
+
+    _buffer->put_u32(p_function->constants.size());
+    for (const Variant& constant : p_function->constants) {
+        _write_value(constant);
+    }
+
+    _buffer->put_u32(p_function->global_names.size());
+    for (const StringName& global_name : p_function->global_names) {
+        _write_string(global_name);
+    }
+
+    // Function pointer tables are written by name, each name is resolved again when loaded
+    if (p_function->utilities_names.size() != p_function->utilities_count
+            || p_function->os_utilities_names.size() != p_function->os_utilities_count
+            || p_function->methods_names.size() != p_function->methods_count) {
+        _fail(vformat("function '%s' calls a function that was not recorded by name", p_function->name));
+        return;
+    }
+
+    _buffer->put_u32(p_function->utilities_count);
+    for (const String& utility_name : p_function->utilities_names) {
+        _write_string(utility_name);
+    }
+
+    _buffer->put_u32(p_function->os_utilities_count);
+    for (const String& utility_name : p_function->os_utilities_names) {
+        _write_string(utility_name);
+    }
+
+    _buffer->put_u32(p_function->methods_count);
+    for (const String& method_name : p_function->methods_names) {
+        _write_string(method_name);
+    }
+
+    // Validated instructions use engine pointers, written by the signature each was resolved from
+    for (int i = 0; i < OScriptCompiledFunction::POINTER_TABLE_MAX; i++) {
+        const Vector<OScriptCompiledFunction::PointerSignature>& signatures = p_function->pointer_signatures[i];
+        if (signatures.size() != _get_pointer_table_size(p_function, i)) {
+            _fail(vformat("function '%s' uses a validated instruction that was not recorded by signature", p_function->name));
+            return;
+        }
+
+        _buffer->put_u32(signatures.size());
+        for (const OScriptCompiledFunction::PointerSignature& signature : signatures) {
+            _buffer->put_32(signature.type);
+            _buffer->put_32(signature.right_type);
+            _buffer->put_32(signature.index);
+            _write_string(signature.name);
+            _buffer->put_64(signature.hash);
+        }
+    }
+
+    _buffer->put_u32(p_function->lambdas_count);
+    for (int i = 0; i < p_function->lambdas_count; i++) {
+        OScriptCompiledFunction* lambda = p_function->_lambdas_ptr[i];
+        HashMap<OScriptCompiledFunction*, OScript::LambdaInfo>::ConstIterator E = p_function->_script->lambda_info.find(lambda);
+        if (!E) {
+            _fail(vformat("function '%s' has a lambda without capture information", p_function->name));
+            return;
+        }
+        _buffer->put_32(E->value.capture_count);
+        _buffer->put_u8(E->value.use_self);
+        _write_function(lambda);
+    }
+
+    _buffer->put_u32(p_function->oscript_function_names.size());
+    for (const StringName& function_name : p_function->oscript_function_names) {
+        _write_string(function_name);
+    }
+
+    _buffer->put_32(p_function->member_caches_count);
+
+    // Switch tables are recorded by their cases, the lookup structures are built again when loaded
+    _buffer->put_u32(p_function->switch_tables.size());
+    for (const OScriptCompiledFunction::SwitchTable& table : p_function->switch_tables) {
+        _buffer->put_32(table.type);
+        _buffer->put_32(table.default_branch);
+        _buffer->put_u32(table.values.size());
+        for (int i = 0; i < table.values.size(); i++) {
+            _write_value(table.values[i]);
+            _buffer->put_32(table.value_branches[i]);
+        }
+        _buffer->put_u32(table.targets.size());
+        for (int target : table.targets) {
+            _buffer->put_32(target);
+        }
+    }
+
+    _write_string(p_function->profile.signature);
+}
+
+void OScriptBytecodeImage::_write_class_tree(const OScript* p_script) {
+    _write_string(p_script->fully_qualified_name);
+    _write_string(p_script->local_name);
+    _write_string(p_script->global_name);
+    _write_string(p_script->simplified_icon_path);
+
+    _buffer->put_u32(p_script->subclasses.size());
+    for (const KeyValue<StringName, Ref<OScript>>& E : p_script->subclasses) {
+        _write_string(E.key);
+        _write_class_tree(E.value.ptr());
+    }
+}
+
+void OScriptBytecodeImage::_write_class(const OScript* p_script) {
+    if (!p_script->_valid) {
+        _fail(vformat("class '%s' did not compile", p_script->fully_qualified_name));
+        return;
+    }
+
+    _buffer->put_u8(p_script->_tool);
+    _buffer->put_u8(p_script->is_abstract);
+    _write_string(p_script->native.is_valid() ? String(p_script->native->get_name()) : String());
+    _write_script_ref(p_script->base);
+
+    _buffer->put_u32(p_script->member_indices.size());
+    for (const KeyValue<StringName, OScript::MemberInfo>& E : p_script->member_indices) {
+        _write_member_info(E.key, E.value);
+    }
+
+    _buffer->put_u32(p_script->members.size());
+    for (const StringName& member : p_script->members) {
+        _write_string(member);
+    }
+
+    _buffer->put_u32(p_script->member_default_image.size());
+    for (const Variant& value : p_script->member_default_image) {
+        _write_value(value);
+    }
+
+    _buffer->put_u32(p_script->static_variables_indices.size());
+    for (const KeyValue<StringName, OScript::MemberInfo>& E : p_script->static_variables_indices) {
+        _write_member_info(E.key, E.value);
+    }
+
+    _buffer->put_u32(p_script->constants.size());
+    for (const KeyValue<StringName, Variant>& E : p_script->constants) {
+        _write_string(E.key);
+        _write_value(E.value);
+    }
+
+    _buffer->put_u32(p_script->signals.size());
+    for (const KeyValue<StringName, MethodInfo>& E : p_script->signals) {
+        _write_string(E.key);
+        _write_value(DictionaryUtils::from_method(E.value));
+    }
+
+    _write_value(p_script->rpc_config);
+
+    _buffer->put_u32(p_script->member_functions.size());
+    for (const KeyValue<StringName, OScriptCompiledFunction*>& E : p_script->member_functions) {
+        _write_string(E.key);
+        _write_function(E.value);
+    }
+
+    const OScriptCompiledFunction* special_functions[] = {
+        p_script->implicit_initializer,
+        p_script->implicit_ready,
+        p_script->static_initializer
+    };
+    for (const OScriptCompiledFunction* function : special_functions) {
+        _buffer->put_u8(function != nullptr);
+        if (function) {
+            _write_function(function);
+        }
+    }
+    _buffer->put_u8(p_script->has_implicit_initialization);
+
+    for (const KeyValue<StringName, Ref<OScript>>& E : p_script->subclasses) {
+        _write_class(E.value.ptr());
+    }
+}
+
+#endif
+
+bool OScriptBytecodeImage::_has_available(int p_bytes) {
+    if (_failed || _buffer->get_available_bytes() < p_bytes) {
+        _fail();
+        return false;
+    }
+    return true;
+}
+
+uint32_t OScriptBytecodeImage::_read_u32() {
+    return _has_available(4) ? static_cast<uint32_t>(_buffer->get_u32()) : 0;
+}
+
+int32_t OScriptBytecodeImage::_read_32() {
+    return _has_available(4) ? _buffer->get_32() : 0;
+}
+
+int64_t OScriptBytecodeImage::_read_64() {
+    return _has_available(8) ? _buffer->get_64() : 0;
+}
+
+bool OScriptBytecodeImage::_read_bool() {
+    return _has_available(1) ? _buffer->get_u8() != 0 : false;
+}
+
+String OScriptBytecodeImage::_read_string() {
+    return _has_available(4) ? _buffer->get_utf8_string() : String();
+}
+
+Variant OScriptBytecodeImage::_read_var() {
+    return _has_available(4) ? _buffer->get_var() : Variant();
+}
+
+Ref<Script> OScriptBytecodeImage::_read_script_ref() {
+    if (!_has_available(1)) {
+        return {};
+    }
+
+    switch (_buffer->get_u8()) {
+        case 0: {
+            return {};
+        }
+        case 1: {
+            const String path = _read_string();
+            const String fully_qualified_name = _read_string();
+            if (_failed) {
+                return {};
+            }
+
+            Ref<OScript> script;
+            if (path == _root->path) {
+                script = Ref<OScript>(_root);
+            } else {
+                // Registered as a dependency of the root, so finish_compiling brings it up to date
+                Error err = OK;
+                script = OScriptCache::get_shallow_script(path, err, _root->path);
+                if (err) {
+                    _fail();
+                    return {};
+                }
+            }
+
+            OScript* result = script.is_valid() ? script->find_class(fully_qualified_name) : nullptr;
+            if (!result) {
+                _fail();
+                return {};
+            }
+            return Ref<Script>(result);
+        }
+        case 2: {
+            const Ref<Script> script = ResourceLoader::get_singleton()->load(_read_string());
+            if (script.is_null()) {
+                _fail();
+            }
+            return script;
+        }
+        default: {
+            _fail();
+            return {};
+        }
+    }
+}
+
+Variant OScriptBytecodeImage::_read_value() {
+    if (!_has_available(1)) {
+        return {};
+    }
+
+    switch (_buffer->get_u8()) {
+        case VALUE_PLAIN: {
+            return _read_var();
+        }
+        case VALUE_NULL_OBJECT: {
+            return static_cast<Object*>(nullptr);
+        }
+        case VALUE_NATIVE_CLASS: {
+            const StringName name = _read_string();
+            const HashMap<StringName, int>& globals = OScriptLanguage::get_singleton()->get_global_map();
+            if (!globals.has(name)) {
+                _fail();
+                return {};
+            }
+            return OScriptLanguage::get_singleton()->get_global_array()[globals[name]];
+        }
+        case VALUE_OSCRIPT: {
+            return _read_script_ref();
+        }
+        case VALUE_RESOURCE: {
+            const Ref<Resource> resource = ResourceLoader::get_singleton()->load(_read_string());
+            if (resource.is_null()) {
+                _fail();
+            }
+            return resource;
+        }
+        default: {
+            _fail();
+            return {};
+        }
+    }
+}
+
+OScriptDataType OScriptBytecodeImage::_read_data_type() {
+    OScriptDataType type;
+    if (!_has_available(1)) {
+        return type;
+    }
+
+    type.kind = static_cast<OScriptDataType::Kind>(_buffer->get_u8());
+    type.builtin_type = static_cast<Variant::Type>(_read_32());
+    type.native_type = _read_string();
+
+    const Ref<Script> script = _read_script_ref();
+    type.script_type = script.ptr();
+
+    // Mirrors OScriptCompiler::resolve_type, classes local to the root are not held strongly to avoid
+    // cyclic references.
+    const Ref<OScript> oscript = script;
+    if (oscript.is_null() || oscript->get_root_script() != _root) {
+        type.script_type_ref = script;
+    }
+
+    const uint32_t element_count = _read_u32();
+    for (uint32_t i = 0; i < element_count && !_failed; i++) {
+        type.container_element_types.push_back(_read_data_type());
+    }
+
+    return type;
+}
+
+void OScriptBytecodeImage::_read_member_info(HashMap<StringName, OScript::MemberInfo>& r_map) {
+    const StringName name = _read_string();
+
+    OScript::MemberInfo info;
+    info.index = _read_32();
+    info.setter = _read_string();
+    info.getter = _read_string();
+    info.data_type = _read_data_type();
+    info.property_info = DictionaryUtils::to_property(_read_value());
+
+    if (!_failed) {
+        r_map[name] = info;
+    }
+}
+
+bool OScriptBytecodeImage::_resolve_pointer(OScriptCompiledFunction* p_function, int p_table, const OScriptCompiledFunction::PointerSignature& p_signature) {
+    const GDExtensionVariantType type = static_cast<GDExtensionVariantType>(p_signature.type);
+    switch (p_table) {
+        case OScriptCompiledFunction::POINTER_TABLE_OPERATORS: {
+            const GDExtensionPtrOperatorEvaluator evaluator = GDE_INTERFACE(variant_get_ptr_operator_evaluator)(
+                static_cast<GDExtensionVariantOperator>(p_signature.index), type, static_cast<GDExtensionVariantType>(p_signature.right_type));
+            p_function->operator_funcs.push_back(evaluator);
+            #ifdef DEBUG_ENABLED
+            p_function->operator_names.push_back(GDE::Variant::get_operator_name(static_cast<Variant::Operator>(p_signature.index)));
+            #endif
+            return evaluator != nullptr;
+        }
+        case OScriptCompiledFunction::POINTER_TABLE_SETTERS: {
+            const GDExtensionPtrSetter setter = GDE_INTERFACE(variant_get_ptr_setter)(type, p_signature.name._native_ptr());
+            p_function->setters.push_back(setter);
+            #ifdef DEBUG_ENABLED
+            p_function->setter_names.push_back(p_signature.name);
+            #endif
+            return setter != nullptr;
+        }
+        case OScriptCompiledFunction::POINTER_TABLE_GETTERS: {
+            const GDExtensionPtrGetter getter = GDE_INTERFACE(variant_get_ptr_getter)(type, p_signature.name._native_ptr());
+            p_function->getters.push_back(getter);
+            #ifdef DEBUG_ENABLED
+            p_function->getter_names.push_back(p_signature.name);
+            #endif
+            return getter != nullptr;
+        }
+        case OScriptCompiledFunction::POINTER_TABLE_KEYED_SETTERS: {
+            const GDExtensionPtrKeyedSetter setter = GDE_INTERFACE(variant_get_ptr_keyed_setter)(type);
+            p_function->keyed_setters.push_back(setter);
+            return setter != nullptr;
+        }
+        case OScriptCompiledFunction::POINTER_TABLE_KEYED_GETTERS: {
+            const GDExtensionPtrKeyedGetter getter = GDE_INTERFACE(variant_get_ptr_keyed_getter)(type);
+            p_function->keyed_getters.push_back(getter);
+            return getter != nullptr;
+        }
+        case OScriptCompiledFunction::POINTER_TABLE_INDEXED_SETTERS: {
+            const GDExtensionPtrIndexedSetter setter = GDE_INTERFACE(variant_get_ptr_indexed_setter)(type);
+            p_function->indexed_setters.push_back(setter);
+            return setter != nullptr;
+        }
+        case OScriptCompiledFunction::POINTER_TABLE_INDEXED_GETTERS: {
+            const GDExtensionPtrIndexedGetter getter = GDE_INTERFACE(variant_get_ptr_indexed_getter)(type);
+            p_function->indexed_getters.push_back(getter);
+            return getter != nullptr;
+        }
+        case OScriptCompiledFunction::POINTER_TABLE_BUILTIN_METHODS: {
+            const GDExtensionPtrBuiltInMethod method = GDE_INTERFACE(variant_get_ptr_builtin_method)(type, p_signature.name._native_ptr(), p_signature.hash);
+            p_function->builtin_methods.push_back(method);
+            #ifdef DEBUG_ENABLED
+            p_function->builtin_methods_names.push_back(p_signature.name);
+            #endif
+            return method != nullptr;
+        }
+        case OScriptCompiledFunction::POINTER_TABLE_CONSTRUCTORS: {
+            const GDExtensionPtrConstructor constructor = GDE_INTERFACE(variant_get_ptr_constructor)(type, p_signature.index);
+            p_function->constructors.push_back(constructor);
+            #ifdef DEBUG_ENABLED
+            p_function->constructors_names.push_back(Variant::get_type_name(p_signature.type));
+            #endif
+            return constructor != nullptr;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void OScriptBytecodeImage::_read_pointer_tables(OScriptCompiledFunction* p_function) {
+    for (int i = 0; i < OScriptCompiledFunction::POINTER_TABLE_MAX && !_failed; i++) {
+        const uint32_t count = _read_u32();
+        for (uint32_t j = 0; j < count && !_failed; j++) {
+            OScriptCompiledFunction::PointerSignature signature;
+            signature.type = static_cast<Variant::Type>(_read_32());
+            signature.right_type = static_cast<Variant::Type>(_read_32());
+            signature.index = _read_32();
+            signature.name = _read_string();
+            signature.hash = _read_64();
+
+            if (_failed || signature.type < 0 || signature.type >= Variant::VARIANT_MAX
+                    || signature.right_type < 0 || signature.right_type >= Variant::VARIANT_MAX
+                    || !_resolve_pointer(p_function, i, signature)) {
+                _fail();
+                return;
+            }
+
+            #ifdef TOOLS_ENABLED
+            p_function->pointer_signatures[i].push_back(signature);
+            #endif
+        }
+    }
+
+    p_function->operator_funcs_count = p_function->operator_funcs.size();
+    p_function->operator_funcs_ptr = p_function->operator_funcs_count ? p_function->operator_funcs.ptr() : nullptr;
+    p_function->setters_count = p_function->setters.size();
+    p_function->setters_ptr = p_function->setters_count ? p_function->setters.ptr() : nullptr;
+    p_function->getters_count = p_function->getters.size();
+    p_function->getters_ptr = p_function->getters_count ? p_function->getters.ptr() : nullptr;
+    p_function->keyed_setters_count = p_function->keyed_setters.size();
+    p_function->keyed_setters_ptr = p_function->keyed_setters_count ? p_function->keyed_setters.ptr() : nullptr;
+    p_function->keyed_getters_count = p_function->keyed_getters.size();
+    p_function->keyed_getters_ptr = p_function->keyed_getters_count ? p_function->keyed_getters.ptr() : nullptr;
+    p_function->indexed_setters_count = p_function->indexed_setters.size();
+    p_function->indexed_setters_ptr = p_function->indexed_setters_count ? p_function->indexed_setters.ptr() : nullptr;
+    p_function->indexed_getters_count = p_function->indexed_getters.size();
+    p_function->indexed_getters_ptr = p_function->indexed_getters_count ? p_function->indexed_getters.ptr() : nullptr;
+    p_function->builtin_methods_count = p_function->builtin_methods.size();
+    p_function->builtin_methods_ptr = p_function->builtin_methods_count ? p_function->builtin_methods.ptr() : nullptr;
+    p_function->constructors_count = p_function->constructors.size();
+    p_function->constructors_ptr = p_function->constructors_count ? p_function->constructors.ptr() : nullptr;
+}
+
+OScriptCompiledFunction* OScriptBytecodeImage::_read_function(OScript* p_script) {
+    OScriptCompiledFunction* function = memnew(OScriptCompiledFunction);
+    function->name = _read_string();
+    function->_script = p_script;
+    function->source = p_script->get_script_path();
+
+    #ifdef DEBUG_ENABLED
+    function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+    function->_func_cname = function->func_cname.get_data();
+    #endif
+
+    function->_static = _read_bool();
+    function->rpc_config = _read_value();
+    function->return_type = _read_data_type();
+
+    const uint32_t argument_type_count = _read_u32();
+    for (uint32_t i = 0; i < argument_type_count && !_failed; i++) {
+        function->argument_types.push_back(_read_data_type());
+    }
+
+    function->method_info = DictionaryUtils::to_method(_read_value());
+
+    function->initial_node = _read_32();
+    function->argument_count = _read_32();
+    function->vararg_index = _read_32();
+    function->stack_size = _read_32();
+    function->instruction_arg_size = _read_32();
+
+    const uint32_t temporary_slot_count = _read_u32();
+    for (uint32_t i = 0; i < temporary_slot_count && !_failed; i++) {
+        const int slot = _read_32();
+        function->temporary_slots[slot] = static_cast<Variant::Type>(_read_32());
+    }
+    function->_build_frame_layout();
+
+    const uint32_t stack_debug_count = _read_u32();
+    for (uint32_t i = 0; i < stack_debug_count && !_failed; i++) {
+        OScriptCompiledFunction::StackDebug stack_debug;
+        stack_debug.source_node_id = _read_32();
+        stack_debug.pos = _read_32();
+        stack_debug.added = _read_bool();
+        stack_debug.identifier = _read_string();
+        function->stack_debug.push_back(stack_debug);
+    }
+
+    const PackedInt32Array code = _read_var();
+    function->code.resize(code.size());
+    for (int i = 0; i < code.size(); i++) {
+        function->code.write[i] = code[i];
+    }
+    function->code_size = function->code.size();
+    function->code_ptr = function->code_size ? function->code.ptrw() : nullptr;
+
+    const PackedInt32Array operator_signature_positions = _read_var();
+    function->operator_caches.resize(operator_signature_positions.size());
+    for (int i = 0; i < operator_signature_positions.size(); i++) {
+        const int position = operator_signature_positions[i];
+        if (position < 0 || position >= function->code_size) {
+            _fail();
+            break;
+        }
+        function->operator_caches.write[i].signature_pos = position;
+    }
+    function->operator_caches_count = function->operator_caches.size();
+    function->operator_caches_ptr = function->operator_caches_count ? function->operator_caches.ptrw() : nullptr;
+
+    const PackedInt32Array default_arguments = _read_var();
+    function->default_arguments.resize(default_arguments.size());
+    for (int i = 0; i < default_arguments.size(); i++) {
+        function->default_arguments.write[i] = default_arguments[i];
+    }
+    function->default_arg_count = function->default_arguments.size() ? function->default_arguments.size() - 1 : 0;
+    function->default_arg_ptr = function->default_arguments.size() ? function->default_arguments.ptr() : nullptr;
+
+    const PackedInt32Array script_nodes = _read_var();
+    function->script_nodes.resize(script_nodes.size());
+    for (int i = 0; i < script_nodes.size(); i++) {
+        function->script_nodes.write[i] = script_nodes[i];
+    }
+    #ifdef DEBUG_ENABLED
+    function->_init_node_profiles();
+    #endif
+
+    const uint32_t constant_count = _read_u32();
+    for (uint32_t i = 0; i < constant_count && !_failed; i++) {
+        function->constants.push_back(_read_value());
+    }
+    function->constant_count = function->constants.size();
+    function->constants_ptr = function->constant_count ? function->constants.ptrw() : nullptr;
+
+    const uint32_t global_name_count = _read_u32();
+    for (uint32_t i = 0; i < global_name_count && !_failed; i++) {
+        function->global_names.push_back(_read_string());
+    }
+    function->global_names_count = function->global_names.size();
+    function->global_names_ptr = function->global_names_count ? function->global_names.ptr() : nullptr;
+
+    const uint32_t utility_count = _read_u32();
+    for (uint32_t i = 0; i < utility_count && !_failed; i++) {
+        const StringName utility_name = _read_string();
+        const FunctionInfo& fi = ExtensionDB::get_utility_function(utility_name);
+        GDExtensionPtrUtilityFunction utility = GDE_INTERFACE(variant_get_ptr_utility_function)(utility_name._native_ptr(), fi.hash);
+        if (!utility) {
+            _fail();
+        }
+        function->utilities.push_back(utility);
+        #ifdef DEBUG_ENABLED
+        function->utilities_names.push_back(utility_name);
+        #endif
+    }
+    function->utilities_count = function->utilities.size();
+    function->utilities_ptr = function->utilities_count ? function->utilities.ptr() : nullptr;
+
+    const uint32_t os_utility_count = _read_u32();
+    for (uint32_t i = 0; i < os_utility_count && !_failed; i++) {
+        const StringName utility_name = _read_string();
+        OScriptUtilityFunctions::FunctionPtr utility = OScriptUtilityFunctions::get_function(utility_name);
+        if (!utility) {
+            _fail();
+        }
+        function->os_utilities.push_back(utility);
+        #ifdef DEBUG_ENABLED
+        function->os_utilities_names.push_back(utility_name);
+        #endif
+    }
+    function->os_utilities_count = function->os_utilities.size();
+    function->os_utilities_ptr = function->os_utilities_count ? function->os_utilities.ptr() : nullptr;
+
+    const uint32_t method_count = _read_u32();
+    for (uint32_t i = 0; i < method_count && !_failed; i++) {
+        const String method_name = _read_string();
+        MethodBind* method = ExtensionDB::get_method(method_name.get_slice("::", 0), method_name.get_slice("::", 1));
+        if (!method) {
+            _fail();
+        }
+        function->methods.push_back(method);
+        #ifdef DEBUG_ENABLED
+        function->methods_names.push_back(method_name);
+        #endif
+    }
+    function->methods_count = function->methods.size();
+    function->methods_ptr = function->methods_count ? function->methods.ptrw() : nullptr;
+
+    _read_pointer_tables(function);
+
+    const uint32_t lambda_count = _read_u32();
+    for (uint32_t i = 0; i < lambda_count && !_failed; i++) {
+        OScript::LambdaInfo info;
+        info.capture_count = _read_32();
+        info.use_self = _read_bool();
+
+        // Registered right away so that the lambda is released with the script should loading fail
+        OScriptCompiledFunction* lambda = _read_function(p_script);
+        p_script->lambda_info.insert(lambda, info);
+        function->lambdas.push_back(lambda);
+    }
+    function->lambdas_count = function->lambdas.size();
+    function->_lambdas_ptr = function->lambdas_count ? function->lambdas.ptrw() : nullptr;
+
+    // Pointers are resolved when the script is linked, see OScriptCompiler::link_oscript_functions.
+    const uint32_t oscript_function_count = _read_u32();
+    for (uint32_t i = 0; i < oscript_function_count && !_failed; i++) {
+        function->oscript_function_names.push_back(_read_string());
+        function->oscript_functions.push_back(nullptr);
+    }
+    function->oscript_functions_count = function->oscript_functions.size();
+    function->oscript_functions_ptr = function->oscript_functions_count ? function->oscript_functions.ptrw() : nullptr;
+
+    // Entries are resolved by the VM on first execution of each member access.
+    const int member_caches_count = _read_32();
+    for (int i = 0; i < member_caches_count && !_failed; i++) {
+        function->member_caches.push_back(nullptr);
+    }
+    function->member_caches_count = function->member_caches.size();
+    function->member_caches_ptr = function->member_caches_count ? function->member_caches.ptrw() : nullptr;
+
+    const uint32_t switch_table_count = _read_u32();
+    for (uint32_t i = 0; i < switch_table_count && !_failed; i++) {
+        OScriptCompiledFunction::SwitchTable table;
+        table.type = Variant::Type(_read_32());
+        table.default_branch = _read_32();
+
+        const uint32_t value_count = _read_u32();
+        for (uint32_t j = 0; j < value_count && !_failed; j++) {
+            table.values.push_back(_read_value());
+            table.value_branches.push_back(_read_32());
+        }
+
+        const uint32_t target_count = _read_u32();
+        for (uint32_t j = 0; j < target_count && !_failed; j++) {
+            table.targets.push_back(_read_32());
+        }
+
+        // Every branch index must refer to a target, otherwise the lookup would read out of bounds
+        if (table.targets.is_empty() || table.default_branch >= table.targets.size()) {
+            _fail();
+        }
+        for (int branch : table.value_branches) {
+            if (branch < 0 || branch >= table.targets.size()) {
+                _fail();
+            }
+        }
+
+        table.build();
+        function->switch_tables.push_back(table);
+    }
+    function->switch_tables_count = function->switch_tables.size();
+    function->switch_tables_ptr = function->switch_tables_count ? function->switch_tables.ptr() : nullptr;
+
+    const String signature = _read_string();
+    #ifdef DEBUG_ENABLED
+    function->profile.signature = signature;
+    #endif
+
+    return function;
+}
+
+void OScriptBytecodeImage::_read_class_tree(OScript* p_script) {
+    p_script->fully_qualified_name = _read_string();
+    p_script->local_name = _read_string();
+    p_script->global_name = _read_string();
+    p_script->simplified_icon_path = _read_string();
+
+    const HashMap<StringName, Ref<OScript>> old_subclasses = p_script->subclasses;
+    p_script->subclasses.clear();
+
+    const uint32_t subclass_count = _read_u32();
+    for (uint32_t i = 0; i < subclass_count && !_failed; i++) {
+        const StringName name = _read_string();
+
+        Ref<OScript> subclass = old_subclasses.has(name) ? old_subclasses[name] : Ref<OScript>();
+        if (subclass.is_null()) {
+            subclass.instantiate();
+        }
+
+        subclass->subclass_owner = p_script;
+        subclass->path = p_script->path;
+        p_script->subclasses.insert(name, subclass);
+
+        _read_class_tree(subclass.ptr());
+    }
+}
+
+void OScriptBytecodeImage::_read_class(OScript* p_script) {
+    p_script->_tool = _read_bool();
+    p_script->is_abstract = _read_bool();
+
+    const StringName native_name = _read_string();
+    const HashMap<StringName, int>& globals = OScriptLanguage::get_singleton()->get_global_map();
+    if (_failed || !globals.has(native_name)) {
+        _fail();
+        return;
+    }
+
+    p_script->native = OScriptLanguage::get_singleton()->get_global_array()[globals[native_name]];
+    p_script->base = _read_script_ref();
+    if (_failed || p_script->native.is_null()) {
+        _fail();
+        return;
+    }
+
+    // Member tables are recorded in full, including entries inherited from the base script, so they
+    // do not depend on the order in which classes are loaded.
+    const uint32_t member_count = _read_u32();
+    for (uint32_t i = 0; i < member_count && !_failed; i++) {
+        _read_member_info(p_script->member_indices);
+    }
+
+    const uint32_t member_name_count = _read_u32();
+    for (uint32_t i = 0; i < member_name_count && !_failed; i++) {
+        p_script->members.insert(_read_string());
+    }
+
+    const uint32_t member_default_count = _read_u32();
+    if (member_default_count != p_script->member_indices.size()) {
+        _fail();
+        return;
+    }
+    p_script->member_default_image.resize(member_default_count);
+    for (uint32_t i = 0; i < member_default_count && !_failed; i++) {
+        p_script->member_default_image.write[i] = _read_value();
+    }
+
+    const uint32_t static_variable_count = _read_u32();
+    for (uint32_t i = 0; i < static_variable_count && !_failed; i++) {
+        _read_member_info(p_script->static_variables_indices);
+    }
+    p_script->static_variables.resize(p_script->static_variables_indices.size());
+
+    const uint32_t constant_count = _read_u32();
+    for (uint32_t i = 0; i < constant_count && !_failed; i++) {
+        const StringName name = _read_string();
+        p_script->constants.insert(name, _read_value());
+    }
+
+    const uint32_t signal_count = _read_u32();
+    for (uint32_t i = 0; i < signal_count && !_failed; i++) {
+        const StringName name = _read_string();
+        p_script->signals[name] = DictionaryUtils::to_method(_read_value());
+    }
+
+    p_script->rpc_config = _read_value();
+
+    const uint32_t function_count = _read_u32();
+    for (uint32_t i = 0; i < function_count && !_failed; i++) {
+        const StringName name = _read_string();
+        p_script->member_functions[name] = _read_function(p_script);
+    }
+
+    HashMap<StringName, OScriptCompiledFunction*>::Iterator initializer = p_script->member_functions.find(OScriptLanguage::get_singleton()->strings._init);
+    p_script->initializer = initializer ? initializer->value : nullptr;
+
+    OScriptCompiledFunction** special_functions[] = {
+        &p_script->implicit_initializer,
+        &p_script->implicit_ready,
+        &p_script->static_initializer
+    };
+    for (OScriptCompiledFunction** function : special_functions) {
+        if (_read_bool()) {
+            *function = _read_function(p_script);
+        }
+    }
+    p_script->has_implicit_initialization = _read_bool();
+
+    for (const KeyValue<StringName, Ref<OScript>>& E : p_script->subclasses) {
+        if (_failed) {
+            return;
+        }
+        _read_class(E.value.ptr());
+    }
+}
+
+bool OScriptBytecodeImage::_read_header(const String& p_path, int64_t p_source_hash) {
+    if (!_is_enabled()) {
+        return false;
+    }
+
+    const String image_path = get_image_path(p_path);
+    if (p_path.is_empty() || !FileAccess::file_exists(image_path)) {
+        return false;
+    }
+
+    _buffer.instantiate();
+    _buffer->set_data_array(FileAccess::get_file_as_bytes(image_path));
+
+    if (!_has_available(20)) {
+        return false;
+    }
+
+    return _buffer->get_u32() == MAGIC
+        && _buffer->get_u32() == FORMAT_VERSION
+        && _buffer->get_u32() == _get_validation_hash()
+        && _buffer->get_u64() == static_cast<uint64_t>(p_source_hash);
+}
+
+void OScriptBytecodeImage::_clear_script(OScript* p_script) {
+    for (const KeyValue<StringName, Ref<OScript>>& E : p_script->subclasses) {
+        _clear_script(E.value.ptr());
+    }
+
+    p_script->clear();
+    p_script->clearing = false;
+
+    for (const KeyValue<OScriptCompiledFunction*, OScript::LambdaInfo>& E : p_script->lambda_info) {
+        memdelete(E.key);
+    }
+    p_script->lambda_info.clear();
+
+    p_script->initializer = nullptr;
+    p_script->native = Ref<OScriptNativeClass>();
+    p_script->base = Ref<OScript>();
+    p_script->members.clear();
+    p_script->constants.clear();
+    p_script->signals.clear();
+    p_script->rpc_config.clear();
+    p_script->_valid = false;
+}
+
+void OScriptBytecodeImage::_link(OScript* p_script) {
+    OScriptCompiler::link_oscript_functions(p_script);
+    p_script->_update_member_indices_snapshot();
+
+    for (const KeyValue<StringName, Ref<OScript>>& E : p_script->subclasses) {
+        _link(E.value.ptr());
+    }
+
+    p_script->_static_default_init();
+    p_script->_valid = true;
+}
+
+String OScriptBytecodeImage::get_image_path(const String& p_script_path) {
+    return p_script_path.get_basename() + ORCHESTRATOR_SCRIPT_QUALIFY_EXTENSION(ORCHESTRATOR_SCRIPT_IMAGE_EXTENSION);
+}
+
+#ifdef TOOLS_ENABLED
+Error OScriptBytecodeImage::save(OScript* p_script, int64_t p_source_hash, PackedByteArray& r_image, String& r_reason) {
+    ERR_FAIL_NULL_V(p_script, ERR_INVALID_PARAMETER);
+    ERR_FAIL_COND_V(!p_script->is_root_script(), ERR_INVALID_PARAMETER);
+
+    OScriptBytecodeImage image;
+    image._root = p_script;
+    image._buffer.instantiate();
+    image._buffer->put_u32(MAGIC);
+    image._buffer->put_u32(FORMAT_VERSION);
+    image._buffer->put_u32(_get_validation_hash());
+    image._buffer->put_u64(p_source_hash);
+
+    image._write_class_tree(p_script);
+    image._write_class(p_script);
+
+    if (image._failed) {
+        r_reason = image._fail_reason.is_empty() ? String("it holds state that cannot be serialized") : image._fail_reason;
+        return ERR_UNAVAILABLE;
+    }
+
+    r_image = image._buffer->get_data_array();
+    return OK;
+}
+#endif
+
+bool OScriptBytecodeImage::make_scripts(OScript* p_script) {
+    ERR_FAIL_NULL_V(p_script, false);
+
+    OScriptBytecodeImage image;
+    image._root = p_script;
+    if (!image._read_header(p_script->path, p_script->source.hash())) {
+        return false;
+    }
+
+    image._read_class_tree(p_script);
+    return !image._failed;
+}
+
+Error OScriptBytecodeImage::load(OScript* p_script) {
+    ERR_FAIL_NULL_V(p_script, ERR_INVALID_PARAMETER);
+
+    OScriptBytecodeImage image;
+    image._root = p_script;
+    if (!image._read_header(p_script->path, p_script->source.hash())) {
+        return ERR_FILE_UNRECOGNIZED;
+    }
+
+    image._read_class_tree(p_script);
+    if (!image._failed) {
+        image._read_class(p_script);
+    }
+
+    if (image._failed || image._buffer->get_available_bytes() != 0) {
+        image._clear_script(p_script);
+        WARN_PRINT("Bytecode image for '" + p_script->path + "' could not be loaded, compiling from source.");
+        return ERR_FILE_CORRUPT;
+    }
+
+    _link(p_script);
+
+    return OScriptCache::finish_compiling(p_script->path);
+}
@@ -0,0 +1,117 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include "script/script.h"
+
+#include <godot_cpp/classes/stream_peer_buffer.hpp>
+
+using namespace godot;
+
+/// Precompiled bytecode image for an <code>OScript</code>.
+///
+/// Images are written by the export plugin from the editor's compiled script and are loaded by the
+/// runtime in place of building the orchestration graph, parsing, analyzing, and compiling it. An
+/// image records the compiled state of the script and its inner classes: member and constant tables,
+/// signals, and each function's code, constants, global names and stack debug information.
+///
+/// Engine pointers (method binds, utility functions, validated operators, accessors, builtin methods and
+/// constructors) are never stored, they are re-resolved by name or signature when the image is loaded. The image is bound to the exact source it was compiled from and to the
+/// Godot and Orchestrator versions that produced it; any mismatch rejects the image so the caller
+/// falls back to compiling the script.
+class OScriptBytecodeImage {
+    static constexpr uint32_t MAGIC = 0x4943534F; // "OSCI"
+    static constexpr uint32_t FORMAT_VERSION = 10;
+
+    enum ValueTag {
+        VALUE_PLAIN,
+        VALUE_NULL_OBJECT,
+        VALUE_NATIVE_CLASS,
+        VALUE_OSCRIPT,
+        VALUE_RESOURCE,
+    };
+
+    Ref<StreamPeerBuffer> _buffer;
+    OScript* _root = nullptr;
+    bool _failed = false;
+    String _fail_reason;
+
+    static uint32_t _get_validation_hash();
+    static bool _is_plain_value(const Variant& p_value);
+    static bool _is_enabled();
+    static int _get_pointer_table_size(const OScriptCompiledFunction* p_function, int p_table);
+
+    void _fail(const String& p_reason = String());
+
+    #ifdef TOOLS_ENABLED
+    void _write_string(const String& p_value);
+    void _write_script_ref(const Ref<Script>& p_script);
+    void _write_value(const Variant& p_value);
+    void _write_data_type(const OScriptDataType& p_type);
+    void _write_member_info(const StringName& p_name, const OScript::MemberInfo& p_info);
+    void _write_function(const OScriptCompiledFunction* p_function);
+    void _write_class_tree(const OScript* p_script);
+    void _write_class(const OScript* p_script);
+    #endif
+
+    bool _has_available(int p_bytes);
+    uint32_t _read_u32();
+    int32_t _read_32();
+    int64_t _read_64();
+    bool _read_bool();
+    String _read_string();
+    Variant _read_var();
+    Ref<Script> _read_script_ref();
+    Variant _read_value();
+    OScriptDataType _read_data_type();
+    void _read_member_info(HashMap<StringName, OScript::MemberInfo>& r_map);
+    bool _resolve_pointer(OScriptCompiledFunction* p_function, int p_table, const OScriptCompiledFunction::PointerSignature& p_signature);
+    void _read_pointer_tables(OScriptCompiledFunction* p_function);
+    OScriptCompiledFunction* _read_function(OScript* p_script);
+    void _read_class_tree(OScript* p_script);
+    void _read_class(OScript* p_script);
+
+    bool _read_header(const String& p_path, int64_t p_source_hash);
+    void _clear_script(OScript* p_script);
+    void _link(OScript* p_script);
+
+public:
+    /// Get the image path that accompanies the given script path.
+    /// @param p_script_path the script path
+    /// @return the image path
+    static String get_image_path(const String& p_script_path);
+
+    #ifdef TOOLS_ENABLED
+    /// Serializes the compiled state of a script.
+    /// @param p_script the root script, must be compiled and valid
+    /// @param p_source_hash the hash of the source the image will be shipped alongside
+    /// @param r_image the serialized image
+    /// @param r_reason why the image could not be written, when it wasn't
+    /// @return OK if the image was written, ERR_UNAVAILABLE if the script holds state that cannot be serialized
+    static Error save(OScript* p_script, int64_t p_source_hash, PackedByteArray& r_image, String& r_reason);
+    #endif
+
+    /// Creates the inner class scripts of a script from its image, when a valid image is present.
+    /// @param p_script the root script, its source must already be loaded
+    /// @return true if the image was used, false if the caller should parse the script instead
+    static bool make_scripts(OScript* p_script);
+
+    /// Loads the compiled state of a script from its image, when a valid image is present.
+    /// @param p_script the root script, its source must already be loaded
+    /// @return OK if the script was loaded, an error if the caller should compile the script instead
+    static Error load(OScript* p_script);
+};
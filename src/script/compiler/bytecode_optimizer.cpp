@@ -0,0 +1,476 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/compiler/bytecode_optimizer.h"
+
+#include "script/compiler/compiled_function.h"
+
+#define IS_OPCODE_IN_RANGE(m_opcode, m_first, m_last) \
+    ((m_opcode) >= OScriptCompiledFunction::m_first && (m_opcode) <= OScriptCompiledFunction::m_last)
+
+#define IS_TYPED_OPERATOR(m_opcode) \
+    IS_OPCODE_IN_RANGE(m_opcode, OPCODE_ADD_INT_INT, OPCODE_DIV_VECTOR3_FLOAT)
+
+int OScriptBytecodeOptimizer::get_instruction_size(const int* p_code, int p_code_size, int p_ip) {
+    const int opcode = p_code[p_ip];
+
+    if (IS_TYPED_OPERATOR(opcode)) {
+        return 4;
+    }
+    if (IS_OPCODE_IN_RANGE(opcode, OPCODE_ITERATE_BEGIN, OPCODE_ITERATE_BEGIN_OBJECT)) {
+        return 5;
+    }
+    if (IS_OPCODE_IN_RANGE(opcode, OPCODE_ITERATE, OPCODE_ITERATE_OBJECT)) {
+        return 5;
+    }
+    if (IS_OPCODE_IN_RANGE(opcode, OPCODE_TYPE_ADJUST_BOOL, OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY)) {
+        return 2;
+    }
+
+    // Instructions with variable arguments encode the argument count after the opcode, followed
+    // by that many addresses and a fixed tail whose size depends on the instruction.
+    int tail = -1;
+
+    switch (opcode) {
+        case OScriptCompiledFunction::OPCODE_OPERATOR:
+            return 7;
+        case OScriptCompiledFunction::OPCODE_OPERATOR_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_OPERATOR_EVALUATE:
+            return 5;
+        case OScriptCompiledFunction::OPCODE_TYPE_TEST_BUILTIN:
+        case OScriptCompiledFunction::OPCODE_TYPE_TEST_NATIVE:
+        case OScriptCompiledFunction::OPCODE_TYPE_TEST_SCRIPT:
+            return 4;
+        case OScriptCompiledFunction::OPCODE_TYPE_TEST_ARRAY:
+            return 6;
+        case OScriptCompiledFunction::OPCODE_TYPE_TEST_DICTIONARY:
+            return 9;
+        case OScriptCompiledFunction::OPCODE_SET_KEYED:
+        case OScriptCompiledFunction::OPCODE_GET_KEYED:
+        case OScriptCompiledFunction::OPCODE_SET_NAMED:
+        case OScriptCompiledFunction::OPCODE_SET_NAMED_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_GET_NAMED:
+        case OScriptCompiledFunction::OPCODE_GET_NAMED_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_SET_MEMBER:
+        case OScriptCompiledFunction::OPCODE_GET_MEMBER:
+        case OScriptCompiledFunction::OPCODE_SET_STATIC_VARIABLE:
+        case OScriptCompiledFunction::OPCODE_GET_STATIC_VARIABLE:
+        case OScriptCompiledFunction::OPCODE_GET_SCENE_NODE:
+            return 4;
+        case OScriptCompiledFunction::OPCODE_SET_KEYED_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_SET_INDEXED_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_GET_KEYED_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_GET_INDEXED_VALIDATED:
+            return 5;
+        case OScriptCompiledFunction::OPCODE_ASSIGN:
+            return 3;
+        case OScriptCompiledFunction::OPCODE_ASSIGN_NULL:
+        case OScriptCompiledFunction::OPCODE_ASSIGN_TRUE:
+        case OScriptCompiledFunction::OPCODE_ASSIGN_FALSE:
+            return 2;
+        case OScriptCompiledFunction::OPCODE_ASSIGN_TYPED_BUILTIN:
+        case OScriptCompiledFunction::OPCODE_ASSIGN_TYPED_NATIVE:
+        case OScriptCompiledFunction::OPCODE_ASSIGN_TYPED_SCRIPT:
+        case OScriptCompiledFunction::OPCODE_CAST_TO_BUILTIN:
+        case OScriptCompiledFunction::OPCODE_CAST_TO_NATIVE:
+        case OScriptCompiledFunction::OPCODE_CAST_TO_SCRIPT:
+            return 4;
+        case OScriptCompiledFunction::OPCODE_ASSIGN_TYPED_ARRAY:
+            return 6;
+        case OScriptCompiledFunction::OPCODE_ASSIGN_TYPED_DICTIONARY:
+            return 9;
+        case OScriptCompiledFunction::OPCODE_CONSTRUCT_ARRAY:
+        case OScriptCompiledFunction::OPCODE_CONSTRUCT_DICTIONARY:
+            tail = 2;
+            break;
+        case OScriptCompiledFunction::OPCODE_CONSTRUCT:
+        case OScriptCompiledFunction::OPCODE_CONSTRUCT_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_CALL:
+        case OScriptCompiledFunction::OPCODE_CALL_RETURN:
+        case OScriptCompiledFunction::OPCODE_CALL_ASYNC:
+        case OScriptCompiledFunction::OPCODE_CALL_METHOD_BIND:
+        case OScriptCompiledFunction::OPCODE_CALL_METHOD_BIND_RET:
+        case OScriptCompiledFunction::OPCODE_CALL_NATIVE_STATIC:
+        case OScriptCompiledFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+        case OScriptCompiledFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN:
+        case OScriptCompiledFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+        case OScriptCompiledFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN:
+        case OScriptCompiledFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_CALL_UTILITY:
+        case OScriptCompiledFunction::OPCODE_CALL_UTILITY_VALIDATED:
+        case OScriptCompiledFunction::OPCODE_CALL_OSCRIPT_UTILITY:
+        case OScriptCompiledFunction::OPCODE_CALL_SELF_BASE:
+        case OScriptCompiledFunction::OPCODE_CREATE_LAMBDA:
+        case OScriptCompiledFunction::OPCODE_CREATE_SELF_LAMBDA:
+            tail = 3;
+            break;
+        case OScriptCompiledFunction::OPCODE_CONSTRUCT_TYPED_ARRAY:
+        case OScriptCompiledFunction::OPCODE_CALL_BUILTIN_STATIC:
+        case OScriptCompiledFunction::OPCODE_CALL_OSCRIPT_FUNCTION:
+        case OScriptCompiledFunction::OPCODE_CALL_OSCRIPT_FUNCTION_RETURN:
+            tail = 4;
+            break;
+        case OScriptCompiledFunction::OPCODE_CONSTRUCT_TYPED_DICTIONARY:
+            tail = 6;
+            break;
+        case OScriptCompiledFunction::OPCODE_AWAIT:
+        case OScriptCompiledFunction::OPCODE_AWAIT_DELAY:
+        case OScriptCompiledFunction::OPCODE_AWAIT_RESUME:
+        case OScriptCompiledFunction::OPCODE_JUMP:
+        case OScriptCompiledFunction::OPCODE_RETURN:
+        case OScriptCompiledFunction::OPCODE_SCRIPT_NODE:
+            return 2;
+        case OScriptCompiledFunction::OPCODE_JUMP_IF:
+        case OScriptCompiledFunction::OPCODE_JUMP_IF_NOT:
+        case OScriptCompiledFunction::OPCODE_JUMP_IF_SHARED:
+        case OScriptCompiledFunction::OPCODE_SWITCH:
+        case OScriptCompiledFunction::OPCODE_RETURN_TYPED_BUILTIN:
+        case OScriptCompiledFunction::OPCODE_RETURN_TYPED_NATIVE:
+        case OScriptCompiledFunction::OPCODE_RETURN_TYPED_SCRIPT:
+        case OScriptCompiledFunction::OPCODE_STORE_GLOBAL:
+        case OScriptCompiledFunction::OPCODE_STORE_NAMED_GLOBAL:
+        case OScriptCompiledFunction::OPCODE_ASSERT:
+            return 3;
+        case OScriptCompiledFunction::OPCODE_RETURN_TYPED_ARRAY:
+            return 5;
+        case OScriptCompiledFunction::OPCODE_RETURN_TYPED_DICTIONARY:
+            return 8;
+        case OScriptCompiledFunction::OPCODE_ITERATE_BEGIN_RANGE:
+            return 7;
+        case OScriptCompiledFunction::OPCODE_ITERATE_RANGE:
+            return 6;
+        case OScriptCompiledFunction::OPCODE_JUMP_TO_DEF_ARGUMENT:
+        case OScriptCompiledFunction::OPCODE_BREAKPOINT:
+        case OScriptCompiledFunction::OPCODE_END:
+            return 1;
+        default:
+            return 0;
+    }
+
+    if (p_ip + 1 >= p_code_size) {
+        return 0;
+    }
+
+    const int instr_arg_count = p_code[p_ip + 1];
+    if (instr_arg_count < 0) {
+        return 0;
+    }
+
+    return 1 + instr_arg_count + tail;
+}
+
+bool OScriptBytecodeOptimizer::_decode() {
+    const int code_size = _code.size();
+    const int* code = _code.ptr();
+
+    _instruction_of.resize(code_size);
+
+    int ip = 0;
+    while (ip < code_size) {
+        const int size = get_instruction_size(code, code_size, ip);
+        if (size <= 0 || ip + size > code_size) {
+            return false;
+        }
+
+        const int index = _instructions.size();
+        _instructions.push_back(ip);
+        for (int i = 0; i < size; i++) {
+            _instruction_of.write[ip + i] = index;
+        }
+
+        const int opcode = code[ip];
+        if (opcode == OScriptCompiledFunction::OPCODE_JUMP) {
+            _jump_operands.push_back(ip + 1);
+        } else if (opcode == OScriptCompiledFunction::OPCODE_JUMP_IF
+                || opcode == OScriptCompiledFunction::OPCODE_JUMP_IF_NOT
+                || opcode == OScriptCompiledFunction::OPCODE_JUMP_IF_SHARED) {
+            _jump_operands.push_back(ip + 2);
+        } else if (IS_OPCODE_IN_RANGE(opcode, OPCODE_ITERATE_BEGIN, OPCODE_ITERATE_BEGIN_OBJECT)
+                || IS_OPCODE_IN_RANGE(opcode, OPCODE_ITERATE, OPCODE_ITERATE_OBJECT)) {
+            _jump_operands.push_back(ip + 4);
+        } else if (opcode == OScriptCompiledFunction::OPCODE_ITERATE_BEGIN_RANGE) {
+            _jump_operands.push_back(ip + 6);
+        } else if (opcode == OScriptCompiledFunction::OPCODE_ITERATE_RANGE) {
+            _jump_operands.push_back(ip + 5);
+        }
+
+        ip += size;
+    }
+
+    // Every jump must land on an instruction, otherwise the code is not what this pass understands.
+    for (int operand : _jump_operands) {
+        const int target = code[operand];
+        if (target < 0 || target >= code_size || _instructions[_instruction_of[target]] != target) {
+            return false;
+        }
+    }
+
+    for (const Vector<int>* positions : _code_positions) {
+        for (int position : *positions) {
+            if (position < 0 || position > code_size) {
+                return false;
+            }
+        }
+    }
+
+    for (const Vector<int>& uses : _temporary_uses) {
+        for (int use : uses) {
+            if (use < 0 || use >= code_size) {
+                return false;
+            }
+        }
+    }
+
+    _removed.resize(_instructions.size());
+    _removed.fill(false);
+
+    return true;
+}
+
+void OScriptBytecodeOptimizer::_collect_jump_targets() {
+    const int code_size = _code.size();
+
+    _jump_targets.clear();
+    for (int operand : _jump_operands) {
+        _jump_targets.insert(_code[operand]);
+    }
+
+    // Recorded positions that start an instruction are entry points, such as default arguments.
+    for (const Vector<int>* positions : _code_positions) {
+        for (int position : *positions) {
+            if (position < code_size && _instructions[_instruction_of[position]] == position) {
+                _jump_targets.insert(position);
+            }
+        }
+    }
+}
+
+bool OScriptBytecodeOptimizer::_thread_jumps() {
+    bool changed = false;
+
+    for (int operand : _jump_operands) {
+        int target = _code[operand];
+
+        // Bounded by the instruction count, so a cycle of unconditional jumps cannot spin forever.
+        for (int hops = 0; hops < _instructions.size(); hops++) {
+            if (_code[target] != OScriptCompiledFunction::OPCODE_JUMP) {
+                break;
+            }
+            const int next = _code[target + 1];
+            if (next == target) {
+                break;
+            }
+            target = next;
+        }
+
+        if (target != _code[operand]) {
+            _code.write[operand] = target;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void OScriptBytecodeOptimizer::_remove_redundant_jumps() {
+    for (int i = 0; i + 1 < _instructions.size(); i++) {
+        const int ip = _instructions[i];
+        if (_code[ip] == OScriptCompiledFunction::OPCODE_JUMP && _code[ip + 1] == _instructions[i + 1]) {
+            _removed.write[i] = true;
+        }
+    }
+}
+
+int OScriptBytecodeOptimizer::_get_first_write(const Vector<int>& p_uses) const {
+    // A type adjustment immediately before the write only prepares the temporary for it, and both
+    // the operator handlers and the assignments overwrite the destination regardless of its type.
+    if (p_uses.size() > 1) {
+        const int index = _instruction_of[p_uses[0]];
+        const int ip = _instructions[index];
+        if (IS_OPCODE_IN_RANGE(_code[ip], OPCODE_TYPE_ADJUST_BOOL, OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY)
+                && p_uses[0] == ip + 1 && _instruction_of[p_uses[1]] == index + 1) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void OScriptBytecodeOptimizer::_propagate_copies() {
+    // Matches an operator writing a temporary that is only read by the assignment that follows:
+    //     operator T = A op B
+    //     assign D = T
+    // The operator writes D directly. The operator handlers tolerate a destination of any type,
+    // and a destination that aliases an operand.
+    for (const Vector<int>& uses : _temporary_uses) {
+        const int first = _get_first_write(uses);
+        if (uses.size() - first != 2) {
+            continue;
+        }
+
+        const int def = uses[first];
+        const int index = _instruction_of[def];
+        const int ip = _instructions[index];
+        const int opcode = _code[ip];
+
+        if (opcode != OScriptCompiledFunction::OPCODE_OPERATOR && !IS_TYPED_OPERATOR(opcode)) {
+            continue;
+        }
+        if (def != ip + 3 || _removed[index] || index + 1 >= _instructions.size()) {
+            continue;
+        }
+
+        const int assign_ip = _instructions[index + 1];
+        if (_code[assign_ip] != OScriptCompiledFunction::OPCODE_ASSIGN || uses[1] != assign_ip + 2) {
+            continue;
+        }
+
+        // Another path reaching the assignment would skip the operator.
+        if (_removed[index + 1] || _jump_targets.has(assign_ip)) {
+            continue;
+        }
+
+        const int target = _code[assign_ip + 1];
+        if (target == _code[def]) {
+            continue;
+        }
+
+        _code.write[def] = target;
+        _removed.write[index + 1] = true;
+        if (first > 0) {
+            _removed.write[_instruction_of[uses[0]]] = true;
+        }
+    }
+}
+
+void OScriptBytecodeOptimizer::_remove_dead_temporary_writes() {
+    // Only writes without side effects are removed. Clearing a temporary that may hold an object
+    // releases a reference, so null assignments are always kept.
+    for (const Vector<int>& uses : _temporary_uses) {
+        const int first = _get_first_write(uses);
+        if (uses.size() - first != 1) {
+            continue;
+        }
+
+        const int def = uses[first];
+        const int index = _instruction_of[def];
+        const int ip = _instructions[index];
+        const int opcode = _code[ip];
+
+        bool dead = false;
+        if (IS_TYPED_OPERATOR(opcode)) {
+            dead = def == ip + 3;
+        } else if (opcode == OScriptCompiledFunction::OPCODE_ASSIGN
+                || opcode == OScriptCompiledFunction::OPCODE_ASSIGN_TRUE
+                || opcode == OScriptCompiledFunction::OPCODE_ASSIGN_FALSE) {
+            dead = def == ip + 1;
+        }
+
+        if (dead) {
+            _removed.write[index] = true;
+            if (first > 0) {
+                _removed.write[_instruction_of[uses[0]]] = true;
+            }
+        }
+    }
+}
+
+void OScriptBytecodeOptimizer::_collapse_script_nodes() {
+    #ifndef DEBUG_ENABLED
+    // Without a debugger, a marker only records the node used for error reporting, and a marker that
+    // is immediately followed by another is overwritten before any instruction can report it.
+    for (int i = 0; i + 1 < _instructions.size(); i++) {
+        if (_code[_instructions[i]] == OScriptCompiledFunction::OPCODE_SCRIPT_NODE
+                && _code[_instructions[i + 1]] == OScriptCompiledFunction::OPCODE_SCRIPT_NODE) {
+            _removed.write[i] = true;
+        }
+    }
+    #endif
+}
+
+void OScriptBytecodeOptimizer::_relocate() {
+    const int code_size = _code.size();
+
+    // Maps each old position to its new position. Positions within a removed instruction map to the
+    // next instruction that is kept, which is where execution would have continued.
+    Vector<int> remap;
+    remap.resize(code_size + 1);
+
+    int new_size = 0;
+    for (int i = 0; i < _instructions.size(); i++) {
+        const int ip = _instructions[i];
+        const int size = (i + 1 < _instructions.size() ? _instructions[i + 1] : code_size) - ip;
+        for (int j = 0; j < size; j++) {
+            remap.write[ip + j] = _removed[i] ? new_size : new_size + j;
+        }
+        if (!_removed[i]) {
+            new_size += size;
+        }
+    }
+    remap.write[code_size] = new_size;
+
+    for (int operand : _jump_operands) {
+        _code.write[operand] = remap[_code[operand]];
+    }
+
+    for (Vector<int>* positions : _code_positions) {
+        for (int i = 0; i < positions->size(); i++) {
+            positions->write[i] = remap[positions->get(i)];
+        }
+    }
+
+    Vector<int> code;
+    code.resize(new_size);
+    for (int i = 0; i < code_size; i++) {
+        if (!_removed[_instruction_of[i]]) {
+            code.write[remap[i]] = _code[i];
+        }
+    }
+
+    _code = code;
+}
+
+void OScriptBytecodeOptimizer::add_temporary_uses(const Vector<int>& p_uses) {
+    if (!p_uses.is_empty()) {
+        _temporary_uses.push_back(p_uses);
+    }
+}
+
+void OScriptBytecodeOptimizer::add_code_positions(Vector<int>* r_positions) {
+    _code_positions.push_back(r_positions);
+}
+
+bool OScriptBytecodeOptimizer::optimize() {
+    if (!_decode()) {
+        return false;
+    }
+
+    _collect_jump_targets();
+    bool changed = _thread_jumps();
+
+    // Threading can leave jumps that are no longer targeted, so targets are collected again.
+    _collect_jump_targets();
+    _remove_redundant_jumps();
+    _propagate_copies();
+    _remove_dead_temporary_writes();
+    _collapse_script_nodes();
+
+    if (_removed.has(true)) {
+        _relocate();
+        changed = true;
+    }
+
+    return changed;
+}
@@ -0,0 +1,80 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/vector.hpp>
+
+using namespace godot;
+
+/// Peephole optimizer for the bytecode of a single compiled function.
+///
+/// The pass runs on the generator's final code, after temporaries have been assigned stack slots,
+/// and performs local rewrites that the generator cannot see while emitting node by node:
+///  - jumps that target an unconditional jump are threaded to the final destination,
+///  - jumps to the immediately following instruction are removed,
+///  - an operator whose temporary result is only copied into another address writes that address,
+///  - writes to temporaries that are never read are removed.
+///
+/// In builds without debugging support, consecutive script node markers collapse to the last one.
+///
+/// Instructions are only ever removed, never reordered, so jump operands and any other recorded
+/// code positions are relocated after the rewrite. Stack slots are unchanged, which keeps the
+/// function's stack debug information valid.
+class OScriptBytecodeOptimizer {
+    Vector<int>& _code;
+    Vector<Vector<int>> _temporary_uses;
+    Vector<Vector<int>*> _code_positions;
+
+    Vector<int> _instructions;
+    Vector<int> _instruction_of;
+    Vector<bool> _removed;
+    Vector<int> _jump_operands;
+    HashSet<int> _jump_targets;
+
+    bool _decode();
+    void _collect_jump_targets();
+    int _get_first_write(const Vector<int>& p_uses) const;
+    bool _thread_jumps();
+    void _remove_redundant_jumps();
+    void _propagate_copies();
+    void _remove_dead_temporary_writes();
+    void _collapse_script_nodes();
+    void _relocate();
+
+public:
+    /// Get the size of an instruction, in code words.
+    /// @param p_code the function's code
+    /// @param p_code_size the number of words in the code
+    /// @param p_ip the position of the instruction
+    /// @return the instruction size, or 0 if the instruction is unknown or truncated
+    static int get_instruction_size(const int* p_code, int p_code_size, int p_ip);
+
+    /// Records the code positions of the operands that refer to one allocation of a temporary.
+    /// @param p_uses the code positions, in emit order
+    void add_temporary_uses(const Vector<int>& p_uses);
+
+    /// Registers a list of instruction positions that must be relocated with the code.
+    /// @param r_positions the positions, updated in place
+    void add_code_positions(Vector<int>* r_positions);
+
+    /// Runs the pass.
+    /// @return true if the code was changed
+    bool optimize();
+
+    explicit OScriptBytecodeOptimizer(Vector<int>& r_code) : _code(r_code) {}
+};
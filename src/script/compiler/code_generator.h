@@ -90,6 +90,7 @@ public:
     virtual void write_get_member(const Address& p_target, const StringName& p_name) = 0;
     virtual void write_set_static_variable(const Address& p_value, const Address& p_class, int p_index) = 0;
     virtual void write_get_static_variable(const Address& p_target, const Address& p_class, int p_index) = 0;
+    virtual void write_get_scene_node(const Address& p_target, const Address& p_path, int p_slot) = 0;
     virtual void write_assign(const Address& p_target, const Address& p_source) = 0;
     virtual void write_assign_with_conversion(const Address& p_target, const Address& p_source) = 0;
     virtual void write_assign_null(const Address& p_target) = 0;
@@ -108,11 +109,12 @@ public:
     virtual void write_call_builtin_type(const Address& p_target, const Address& p_base, Variant::Type p_type, const StringName& p_method, const Vector<Address>& p_arguments) = 0;
     virtual void write_call_builtin_type_static(const Address& p_target, Variant::Type p_type, const StringName& p_method, const Vector<Address>& p_arguments) = 0;
     virtual void write_call_native_static(const Address& p_target, const StringName& p_class, const StringName& p_method, const Vector<Address>& p_arguments) = 0;
-    virtual void write_call_native_static_validated(const Address& p_target, MethodBind* p_method, const Vector<Address>& p_arguments) = 0;
-    virtual void write_call_method_bind(const Address& p_target, const Address& p_base, MethodBind* p_method, const Vector<Address>& p_arguments) = 0;
-    virtual void write_call_method_bind_validated(const Address& p_target, const Address& p_base, MethodBind* p_method, const Vector<Address>& p_arguments) = 0;
+    virtual void write_call_native_static_validated(const Address& p_target, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) = 0;
+    virtual void write_call_method_bind(const Address& p_target, const Address& p_base, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) = 0;
+    virtual void write_call_method_bind_validated(const Address& p_target, const Address& p_base, MethodBind* p_method, const StringName& p_class, const StringName& p_method_name, const Vector<Address>& p_arguments) = 0;
     virtual void write_call_self(const Address& p_target, const StringName& p_function_name, const Vector<Address>& p_arguments) = 0;
     virtual void write_call_self_async(const Address& p_target, const StringName& p_function_name, const Vector<Address>& p_arguments) = 0;
+    virtual void write_call_oscript_function(const Address& p_target, const StringName& p_function_name, const Vector<Address>& p_arguments) = 0;
     virtual void write_call_script_function(const Address& p_target, const Address& p_base, const StringName& p_function_name, const Vector<Address>& p_arguments) = 0;
     virtual void write_lambda(const Address& p_target, OScriptCompiledFunction* p_function, const Vector<Address>& p_captures, bool p_use_self) = 0;
     virtual void write_construct(const Address& p_target, Variant::Type p_type, const Vector<Address>& p_arguments) = 0;
@@ -121,11 +123,15 @@ public:
     virtual void write_construct_dictionary(const Address& p_target, const Vector<Address>& p_arguments) = 0;
     virtual void write_construct_typed_dictionary(const Address& p_target, const OScriptDataType& p_key_type, const OScriptDataType& p_value_type, const Vector<Address>& p_arguments) = 0;
     virtual void write_await(const Address& p_target, const Address& p_operand) = 0;
+    virtual void write_await_delay(const Address& p_target, const Address& p_duration) = 0;
     virtual void write_if(const Address& p_condition) = 0;
     virtual void write_else() = 0;
     virtual void write_endif() = 0;
     virtual void write_jump_if_shared(const Address& p_value) = 0;
     virtual void write_end_jump_if_shared() = 0;
+    virtual void write_switch(const Address& p_value, const Vector<Variant>& p_branch_values) = 0;
+    virtual void write_switch_branch() = 0;
+    virtual void write_endswitch() = 0;
     virtual void start_for(const OScriptDataType& p_iterator_type, const OScriptDataType& p_list_type, bool p_is_range) = 0;
     virtual void write_for_list_assignment(const Address& p_list) = 0;
     virtual void write_for_range_assignment(const Address& p_from, const Address& p_to, const Address& p_step) = 0;
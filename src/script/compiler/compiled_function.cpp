@@ -16,12 +16,20 @@
 //
 #include "script/compiler/compiled_function.h"
 
+#include "api/extension_db.h"
 #include "common/dictionary_utils.h"
+#include "core/godot/gdextension_compat.h"
+#include "core/godot/object/class_db.h"
 #include "core/godot/variant/variant.h"
 #include "script/language.h"
 #include "script/script.h"
 
+#include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/classes/time.hpp>
 #include <godot_cpp/core/mutex_lock.hpp>
+#include <godot_cpp/variant/variant_internal.hpp>
+
+#include <atomic>
 
 bool OScriptDataType::is_type(const Variant& p_variant, bool p_allow_implicit_conversion) const {
     switch (kind) {
@@ -306,6 +314,16 @@ String OScriptCompiledFunction::to_string() {
     result += "\n";
 
     #ifdef DEBUG_ENABLED
+    if (is_optimized()) {
+        Vector<String> unoptimized_lines;
+        disassemble(Vector<String>(), unoptimized_lines, true);
+        result += vformat("Before optimization (%d -> %d):\n", unoptimized_code.size(), code_size);
+        for (const String& line : unoptimized_lines) {
+            result += vformat("%s\n", line);
+        }
+        result += "\nAfter optimization:\n";
+    }
+
     Vector<String> lines;
     disassemble(Vector<String>(), lines);
     for (const String& line : lines) {
@@ -326,9 +344,299 @@ OScriptCompiledFunction::OScriptCompiledFunction() {
     #endif
 }
 
+void OScriptCompiledFunction::_build_frame_layout() {
+    argument_checks.resize(argument_types.size());
+    untyped_arguments = true;
+    for (int i = 0; i < argument_types.size(); i++) {
+        const OScriptDataType& type = argument_types[i];
+        if (!type.has_type()) {
+            argument_checks[i] = ARGUMENT_UNTYPED;
+            continue;
+        }
+
+        untyped_arguments = false;
+        if (type.kind == OScriptDataType::BUILTIN && !type.has_container_element_types()) {
+            argument_checks[i] = ARGUMENT_BUILTIN;
+        } else {
+            argument_checks[i] = ARGUMENT_CHECKED;
+        }
+    }
+
+    typed_slots.clear();
+    typed_slots.reserve(temporary_slots.size());
+    for (const KeyValue<int, Variant::Type>& E : temporary_slots) {
+        TypedSlot typed_slot;
+        typed_slot.slot = E.key;
+        typed_slot.type = E.value;
+        typed_slots.push_back(typed_slot);
+    }
+
+    struct TypedSlotComparator {
+        _FORCE_INLINE_ bool operator()(const TypedSlot& p_a, const TypedSlot& p_b) const { return p_a.slot < p_b.slot; }
+    };
+    typed_slots.sort_custom<TypedSlotComparator>();
+}
+
+OScriptCompiledFunction::MemberAccessCache* OScriptCompiledFunction::_get_member_access_cache(int p_index, const StringName& p_owner_class, const StringName& p_property, bool p_setter) {
+    std::atomic_ref<MemberAccessCache*> slot(member_caches_ptr[p_index]);
+
+    MemberAccessCache* cache = slot.load(std::memory_order_acquire);
+    if (cache) {
+        return cache;
+    }
+
+    MemberAccessCache* entry = memnew(MemberAccessCache);
+    entry->owner_class = p_owner_class;
+
+    const StringName accessor = p_setter
+        ? GDE::ClassDB::get_property_setter(p_owner_class, p_property)
+        : GDE::ClassDB::get_property_getter(p_owner_class, p_property);
+
+    if (accessor != StringName()) {
+        // Indexed properties pass the index as an extra argument, those remain on the ClassDB path.
+        MethodInfo info;
+        MethodBind* method = ExtensionDB::get_method(p_owner_class, accessor, &info);
+        if (method && info.arguments.size() == (p_setter ? 1 : 0)) {
+            entry->method = method;
+        }
+    }
+
+    if (!slot.compare_exchange_strong(cache, entry, std::memory_order_acq_rel)) {
+        // Another thread published an entry first
+        memdelete(entry);
+        return cache;
+    }
+
+    return entry;
+}
+
+bool OScriptCompiledFunction::_resolve_operator_cache(OperatorCache& r_cache, Variant::Operator p_operator, Variant::Type p_left, Variant::Type p_right) {
+    // Object operands are not stored as their internal value, and only unary operators have no right operand.
+    const bool unary = p_operator == Variant::OP_NEGATE || p_operator == Variant::OP_POSITIVE
+        || p_operator == Variant::OP_NOT || p_operator == Variant::OP_BIT_NEGATE;
+
+    if (p_left == Variant::NIL || p_left == Variant::OBJECT || p_right == Variant::OBJECT) {
+        return false;
+    }
+    if (p_right == Variant::NIL && !unary) {
+        return false;
+    }
+
+    // Validated evaluators do not check for integer division or modulo by zero
+    if (p_operator == Variant::OP_DIVIDE || p_operator == Variant::OP_MODULE) {
+        switch (p_right) {
+            case Variant::INT:
+            case Variant::VECTOR2I:
+            case Variant::VECTOR3I:
+            case Variant::VECTOR4I:
+                return false;
+            default:
+                break;
+        }
+    }
+
+    const Variant::Type return_type = GDE::Variant::get_operator_return_type(p_operator, p_left, p_right);
+    if (return_type == Variant::NIL || return_type == Variant::OBJECT) {
+        return false;
+    }
+
+    const GDExtensionPtrOperatorEvaluator evaluator = GDE::Variant::get_validated_operator_evaluator(p_operator, p_left, p_right);
+    if (!evaluator) {
+        return false;
+    }
+
+    r_cache.evaluator = evaluator;
+    r_cache.return_type = return_type;
+    r_cache.left = GDE_INTERFACE(get_variant_get_internal_ptr_func)(static_cast<GDExtensionVariantType>(p_left));
+    r_cache.result = GDE_INTERFACE(get_variant_get_internal_ptr_func)(static_cast<GDExtensionVariantType>(return_type));
+    r_cache.right = p_right != Variant::NIL
+        ? GDE_INTERFACE(get_variant_get_internal_ptr_func)(static_cast<GDExtensionVariantType>(p_right))
+        : nullptr;
+
+    return r_cache.left && r_cache.result && (r_cache.right || p_right == Variant::NIL);
+}
+
+void OScriptCompiledFunction::SwitchTable::build() {
+    dense.clear();
+    integers.clear();
+    strings.clear();
+    string_names.clear();
+
+    const int default_index = default_branch >= 0 ? default_branch : targets.size() - 1;
+
+    if (type == Variant::INT) {
+        int64_t min_value = 0;
+        int64_t max_value = 0;
+        for (int i = 0; i < values.size(); i++) {
+            const int64_t value = values[i];
+            min_value = i == 0 ? value : MIN(min_value, value);
+            max_value = i == 0 ? value : MAX(max_value, value);
+        }
+
+        // Enumerations and state indices are usually compact, those get a direct array lookup
+        // The span is computed without the +1 so that INT64_MIN..INT64_MAX cannot wrap to zero
+        const uint64_t span = uint64_t(max_value) - uint64_t(min_value);
+        if (!values.is_empty() && span < uint64_t(MAX(values.size() * 2, 16))) {
+            dense_min = min_value;
+            dense.resize(int64_t(span + 1));
+            dense.fill(default_index);
+            for (int i = values.size() - 1; i >= 0; i--) {
+                const uint64_t offset = uint64_t(int64_t(values[i])) - uint64_t(min_value);
+                dense.write[offset] = value_branches[i];
+            }
+            return;
+        }
+
+        for (int i = 0; i < values.size(); i++) {
+            const int64_t value = values[i];
+            if (!integers.has(value)) {
+                integers[value] = value_branches[i];
+            }
+        }
+        return;
+    }
+
+    // Strings match both String and StringName values, just like match does
+    for (int i = 0; i < values.size(); i++) {
+        const String value = values[i];
+        if (!strings.has(value)) {
+            strings[value] = value_branches[i];
+            string_names[StringName(value)] = value_branches[i];
+        }
+    }
+}
+
+int OScriptCompiledFunction::SwitchTable::find_target(const Variant* p_value) const {
+    int branch = default_branch >= 0 ? default_branch : targets.size() - 1;
+
+    switch (p_value->get_type()) {
+        case Variant::INT: {
+            if (type == Variant::INT) {
+                const int64_t value = *VariantInternal::get_int(p_value);
+                if (!dense.is_empty()) {
+                    const uint64_t offset = uint64_t(value) - uint64_t(dense_min);
+                    if (offset < uint64_t(dense.size())) {
+                        branch = dense[offset];
+                    }
+                } else if (const int* E = integers.getptr(value)) {
+                    branch = *E;
+                }
+            }
+            break;
+        }
+        case Variant::STRING: {
+            if (type == Variant::STRING) {
+                if (const int* E = strings.getptr(*VariantInternal::get_string(p_value))) {
+                    branch = *E;
+                }
+            }
+            break;
+        }
+        case Variant::STRING_NAME: {
+            if (type == Variant::STRING) {
+                if (const int* E = string_names.getptr(*VariantInternal::get_string_name(p_value))) {
+                    branch = *E;
+                }
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+
+    return targets[branch];
+}
+
+bool OScriptCompiledFunction::_has_breakpoints() {
+    const uint64_t generation = OScriptLanguage::get_singleton()->get_breakpoint_generation();
+    if (breakpoint_generation.get() != generation) {
+        EngineDebugger* debugger = EngineDebugger::get_singleton();
+
+        bool found = false;
+        for (int node_id : script_nodes) {
+            if (debugger->is_breakpoint(node_id, source)) {
+                found = true;
+                break;
+            }
+        }
+
+        breakpoint_in_function.set_to(found);
+        breakpoint_generation.set(generation);
+    }
+
+    return breakpoint_in_function.is_set();
+}
+
+#ifdef DEBUG_ENABLED
+void OScriptCompiledFunction::_init_node_profiles() {
+    // Node profiles are allocated when profiling starts, unless the function is compiled while it runs.
+    if (OScriptLanguage::get_singleton()->profiling) {
+        _start_node_profiles();
+    }
+}
+
+void OScriptCompiledFunction::_start_node_profiles() {
+    if (profile.nodes.size() != uint32_t(script_nodes.size())) {
+        profile.nodes.resize(script_nodes.size());
+    }
+
+    for (Profile::NodeProfile& node : profile.nodes) {
+        node.hit_count.set(0);
+        node.total_time.set(0);
+    }
+}
+
+int OScriptCompiledFunction::_get_node_profile_slot(int p_node) const {
+    int low = 0;
+    int high = script_nodes.size() - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        const int node_id = script_nodes[middle];
+        if (node_id == p_node) {
+            return middle;
+        }
+        if (node_id < p_node) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return -1;
+}
+
+void OScriptCompiledFunction::_profile_node(int p_node, int& r_current_node, uint64_t& r_node_start_time) {
+    const uint64_t now = Time::get_singleton()->get_ticks_usec();
+
+    // The start time is unset when profiling began while the function was running.
+    if (r_current_node >= 0 && r_node_start_time > 0) {
+        const int current = _get_node_profile_slot(r_current_node);
+        if (current >= 0 && uint32_t(current) < profile.nodes.size()) {
+            profile.nodes[current].total_time.add(now - r_node_start_time);
+        }
+    }
+
+    if (p_node >= 0) {
+        const int slot = _get_node_profile_slot(p_node);
+        if (slot >= 0 && uint32_t(slot) < profile.nodes.size()) {
+            profile.nodes[slot].hit_count.increment();
+        }
+    }
+
+    r_current_node = p_node;
+    r_node_start_time = now;
+}
+#endif
+
 OScriptCompiledFunction::~OScriptCompiledFunction() {
     get_script()->member_functions.erase(name);
 
+    for (int i = 0; i < member_caches_count; i++) {
+        if (member_caches_ptr[i]) {
+            memdelete(member_caches_ptr[i]);
+        }
+    }
+
     for (int i = 0; i < argument_types.size(); i++) {
         argument_types.write[i].script_type_ref = Ref<Script>();
     }
@@ -381,7 +689,7 @@ bool OScriptFunctionState::is_valid(bool p_extended_check) const {
     }
 
     if (p_extended_check) {
-        MutexLock lock(*OScriptLanguage::get_singleton()->lock.ptr());
+        MutexLock lock(*OScriptLanguage::get_singleton()->func_state_lock.ptr());
         if (!scripts_list.in_list()) {
             return false;
         }
@@ -396,7 +704,7 @@ bool OScriptFunctionState::is_valid(bool p_extended_check) const {
 Variant OScriptFunctionState::resume(const Variant& p_arg) {
     ERR_FAIL_NULL_V(function, Variant());
     {
-        MutexLock lock(*OScriptLanguage::get_singleton()->lock.ptr());
+        MutexLock lock(*OScriptLanguage::get_singleton()->func_state_lock.ptr());
         if (!scripts_list.in_list()) {
             #ifdef DEBUG_ENABLED
             ERR_FAIL_V_MSG(Variant(), "Resumed function '" + state.function_name
@@ -423,6 +731,7 @@ Variant OScriptFunctionState::resume(const Variant& p_arg) {
     GDExtensionCallError error;
     Variant result = function->call(nullptr, nullptr, 0, error, &state);
 
+    // The call returns the stack buffer to the function's pool itself, as the function may be gone by now.
     function = nullptr; // Cleaned up.
     state.result = Variant();
 
@@ -467,7 +776,7 @@ OScriptFunctionState::OScriptFunctionState() : scripts_list(this), instances_lis
 }
 
 OScriptFunctionState::~OScriptFunctionState() {
-    MutexLock lock(*OScriptLanguage::get_singleton()->lock.ptr());
+    MutexLock lock(*OScriptLanguage::get_singleton()->func_state_lock.ptr());
     scripts_list.remove_from_list();
     instances_list.remove_from_list();
     _clear_stack();
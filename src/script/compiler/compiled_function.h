@@ -22,6 +22,8 @@
 #include <godot_cpp/core/method_bind.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/list.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/safe_refcount.hpp>
 #include <godot_cpp/templates/self_list.hpp>
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/variant.hpp>
@@ -31,6 +33,7 @@ using namespace godot;
 /// Forward declaration
 class OScript;
 class OScriptCompiler;
+class OScriptFunctionState;
 class OScriptInstance;
 class OScriptLanguage;
 
@@ -83,6 +86,7 @@ public:
 
 class OScriptCompiledFunction {
     friend class OScript;
+    friend class OScriptBytecodeImage;
     friend class OScriptCompiler;
     friend class OScriptBytecodeGenerator;
     friend class OScriptLanguage;
@@ -91,6 +95,33 @@ public:
     enum Opcode {
         OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_ADD_INT_INT,
+		OPCODE_SUB_INT_INT,
+		OPCODE_MUL_INT_INT,
+		OPCODE_EQUAL_INT_INT,
+		OPCODE_NOT_EQUAL_INT_INT,
+		OPCODE_LESS_INT_INT,
+		OPCODE_LESS_EQUAL_INT_INT,
+		OPCODE_GREATER_INT_INT,
+		OPCODE_GREATER_EQUAL_INT_INT,
+		OPCODE_ADD_FLOAT_FLOAT,
+		OPCODE_SUB_FLOAT_FLOAT,
+		OPCODE_MUL_FLOAT_FLOAT,
+		OPCODE_DIV_FLOAT_FLOAT,
+		OPCODE_LESS_FLOAT_FLOAT,
+		OPCODE_LESS_EQUAL_FLOAT_FLOAT,
+		OPCODE_GREATER_FLOAT_FLOAT,
+		OPCODE_GREATER_EQUAL_FLOAT_FLOAT,
+		OPCODE_ADD_VECTOR2_VECTOR2,
+		OPCODE_SUB_VECTOR2_VECTOR2,
+		OPCODE_MUL_VECTOR2_VECTOR2,
+		OPCODE_MUL_VECTOR2_FLOAT,
+		OPCODE_DIV_VECTOR2_FLOAT,
+		OPCODE_ADD_VECTOR3_VECTOR3,
+		OPCODE_SUB_VECTOR3_VECTOR3,
+		OPCODE_MUL_VECTOR3_VECTOR3,
+		OPCODE_MUL_VECTOR3_FLOAT,
+		OPCODE_DIV_VECTOR3_FLOAT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -110,6 +141,7 @@ public:
 		OPCODE_GET_MEMBER,
 		OPCODE_SET_STATIC_VARIABLE, // Only for OScript.
 		OPCODE_GET_STATIC_VARIABLE, // Only for OScript.
+		OPCODE_GET_SCENE_NODE, // Only for OScript.
 		OPCODE_ASSIGN,
 		OPCODE_ASSIGN_NULL,
 		OPCODE_ASSIGN_TRUE,
@@ -136,6 +168,8 @@ public:
 		OPCODE_CALL_OSCRIPT_UTILITY,
 		OPCODE_CALL_BUILTIN_TYPE_VALIDATED,
 		OPCODE_CALL_SELF_BASE,
+		OPCODE_CALL_OSCRIPT_FUNCTION,
+		OPCODE_CALL_OSCRIPT_FUNCTION_RETURN,
 		OPCODE_CALL_METHOD_BIND,
 		OPCODE_CALL_METHOD_BIND_RET,
 		OPCODE_CALL_BUILTIN_STATIC,
@@ -145,6 +179,7 @@ public:
 		OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN,
 		OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN,
 		OPCODE_AWAIT,
+		OPCODE_AWAIT_DELAY,
 		OPCODE_AWAIT_RESUME,
 		OPCODE_CREATE_LAMBDA,
 		OPCODE_CREATE_SELF_LAMBDA,
@@ -153,6 +188,7 @@ public:
 		OPCODE_JUMP_IF_NOT,
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_JUMP_IF_SHARED,
+		OPCODE_SWITCH,
 		OPCODE_RETURN,
 		OPCODE_RETURN_TYPED_BUILTIN,
 		OPCODE_RETURN_TYPED_ARRAY,
@@ -277,6 +313,52 @@ public:
         StringName identifier;
     };
 
+    /// Inline cache for native member access, one per GET_MEMBER/SET_MEMBER instruction. Each entry
+    /// is published once for the first owner class observed; other owner classes use the slow path.
+    struct MemberAccessCache {
+        StringName owner_class;
+        MethodBind* method = nullptr; // Null when the accessor cannot be called directly
+    };
+
+    // OPCODE_OPERATOR signature slot states, a resolved slot holds (left_type << 8) | right_type
+    static constexpr int OPERATOR_SIGNATURE_UNRESOLVED = 0;
+    static constexpr int OPERATOR_SIGNATURE_PENDING = -1;
+    static constexpr int OPERATOR_SIGNATURE_GENERIC = -2;
+
+    struct OperatorCache {
+        GDExtensionPtrOperatorEvaluator evaluator = nullptr;
+        GDExtensionVariantGetInternalPtrFunc left = nullptr;
+        GDExtensionVariantGetInternalPtrFunc right = nullptr; // Null for unary operators
+        GDExtensionVariantGetInternalPtrFunc result = nullptr;
+        Variant::Type return_type = Variant::NIL;
+        int signature_pos = 0; // Code position of the instruction's signature slot
+    };
+
+    /// Branch table of a switch instruction, built from the constant case values of a match whose
+    /// cases are all integers or all strings. Integer cases over a compact range are looked up in a
+    /// dense array, all other cases are hashed.
+    struct SwitchTable {
+        Variant::Type type = Variant::NIL; // Either Variant::INT or Variant::STRING
+        Vector<Variant> values;            // Case values, in match order
+        Vector<int> value_branches;        // Branch index of each case value
+        Vector<int> targets;               // Code position of each branch, followed by the end of the switch
+        int default_branch = -1;           // Branch taken when no case matches, the end if there is none
+
+        int64_t dense_min = 0;
+        Vector<int> dense;
+        HashMap<int64_t, int> integers;
+        HashMap<String, int> strings;
+        HashMap<StringName, int> string_names;
+
+        /// Builds the lookup structures from the case values, the first of duplicate values wins.
+        void build();
+
+        /// Get the code position to continue at for the given value.
+        /// @param p_value the matched value
+        /// @return the code position
+        int find_target(const Variant* p_value) const;
+    };
+
 private:
     StringName name;
     StringName source;
@@ -298,6 +380,29 @@ private:
     HashMap<int, Variant::Type> temporary_slots;
     List<StackDebug> stack_debug;
 
+    // How an argument is placed on the stack when the function is entered
+    enum ArgumentCheck : uint8_t {
+        ARGUMENT_UNTYPED, // Copied as is
+        ARGUMENT_BUILTIN, // Copied as is when the type matches exactly, otherwise converted
+        ARGUMENT_CHECKED, // Checked and converted using the argument's data type
+    };
+
+    struct TypedSlot {
+        int slot = 0;
+        Variant::Type type = Variant::NIL;
+    };
+
+    // Call frame layout, derived from the argument types and temporary slots by _build_frame_layout()
+    LocalVector<ArgumentCheck> argument_checks;
+    LocalVector<TypedSlot> typed_slots; // Sorted by slot
+    bool untyped_arguments = true;
+
+    // Script node ids that emit OPCODE_SCRIPT_NODE, checked against the debugger's breakpoints.
+    // Sorted by the compiler, so that a node's position is its node profile slot.
+    Vector<int> script_nodes;
+    SafeNumeric<uint64_t> breakpoint_generation;
+    SafeFlag breakpoint_in_function;
+
     Vector<int> code;
     Vector<int> default_arguments;
     Vector<Variant> constants;
@@ -315,6 +420,39 @@ private:
     Vector<OScriptUtilityFunctions::FunctionPtr> os_utilities;
     Vector<MethodBind*> methods;
     Vector<OScriptCompiledFunction*> lambdas;
+    Vector<StringName> oscript_function_names;
+    Vector<OScriptCompiledFunction*> oscript_functions;
+    Vector<MemberAccessCache*> member_caches;
+    Vector<OperatorCache> operator_caches;
+    Vector<SwitchTable> switch_tables;
+
+    // The validated pointer tables, in the order bytecode images store them
+    enum PointerTable {
+        POINTER_TABLE_OPERATORS,
+        POINTER_TABLE_SETTERS,
+        POINTER_TABLE_GETTERS,
+        POINTER_TABLE_KEYED_SETTERS,
+        POINTER_TABLE_KEYED_GETTERS,
+        POINTER_TABLE_INDEXED_SETTERS,
+        POINTER_TABLE_INDEXED_GETTERS,
+        POINTER_TABLE_BUILTIN_METHODS,
+        POINTER_TABLE_CONSTRUCTORS,
+        POINTER_TABLE_MAX
+    };
+
+    // What an engine pointer in a validated table was resolved from, so it can be resolved again
+    struct PointerSignature {
+        Variant::Type type = Variant::NIL; // Base type, or the left operand type of an operator
+        Variant::Type right_type = Variant::NIL; // Right operand type of an operator
+        int32_t index = 0; // Operator, or constructor index
+        StringName name; // Member or method name
+        int64_t hash = 0; // Method hash
+    };
+
+    #ifdef TOOLS_ENABLED
+    // Signatures of the validated table entries, by table and entry index, written to bytecode images
+    Vector<PointerSignature> pointer_signatures[POINTER_TABLE_MAX];
+    #endif
 
     int code_size = 0;
     int default_arg_count = 0;
@@ -333,6 +471,10 @@ private:
     int os_utilities_count = 0;
     int methods_count = 0;
     int lambdas_count = 0;
+    int oscript_functions_count = 0;
+    int member_caches_count = 0;
+    int operator_caches_count = 0;
+    int switch_tables_count = 0;
 
     int* code_ptr = nullptr;
     const int* default_arg_ptr = nullptr;
@@ -351,11 +493,23 @@ private:
     const OScriptUtilityFunctions::FunctionPtr* os_utilities_ptr = nullptr;
     MethodBind** methods_ptr = nullptr;
     OScriptCompiledFunction** _lambdas_ptr = nullptr;
+    OScriptCompiledFunction** oscript_functions_ptr = nullptr;
+    MemberAccessCache** member_caches_ptr = nullptr;
+    OperatorCache* operator_caches_ptr = nullptr;
+    const SwitchTable* switch_tables_ptr = nullptr;
+
+    // Stack buffers of resumed coroutines, reused by the next await in this function. Every buffer
+    // has the same size, and the pool is guarded by the language's function state lock.
+    static constexpr uint32_t MAX_POOLED_STATE_STACKS = 32;
+    LocalVector<Vector<uint8_t>> _state_stack_pool;
 
     #ifdef DEBUG_ENABLED
     CharString func_cname;
     const char* _func_cname = nullptr;
 
+    // Code as generated, kept only when the optimizer changed it
+    Vector<int> unoptimized_code;
+
     Vector<String> operator_names;
     Vector<String> setter_names;
     Vector<String> getter_names;
@@ -363,6 +517,7 @@ private:
     Vector<String> constructors_names;
     Vector<String> utilities_names;
     Vector<String> os_utilities_names;
+    Vector<String> methods_names;
 
     struct Profile {
         StringName signature;
@@ -382,12 +537,32 @@ private:
         } NativeProfile;
         HashMap<String, NativeProfile> native_calls;
         HashMap<String, NativeProfile> last_native_calls;
+
+        // Time is measured from a node's marker to the next one, so it includes the calls the node
+        // makes. Indexed by the node's slot in script_nodes, and allocated when profiling first starts
+        // rather than resized afterward, as threads running the function update it without the lock.
+        struct NodeProfile {
+            SafeNumeric<uint64_t> hit_count;
+            SafeNumeric<uint64_t> total_time;
+        };
+        LocalVector<NodeProfile> nodes;
     } profile;
+
+    void _init_node_profiles();
+    void _start_node_profiles();
+    int _get_node_profile_slot(int p_node) const;
+    void _profile_node(int p_node, int& r_current_node, uint64_t& r_node_start_time);
     #endif
 
     String get_call_error(const String& p_where, const Variant** p_args, int p_arg_count, const Variant& p_result, const GDExtensionCallError& p_error) const;
     String get_callable_call_error(const String& p_where, const Callable& p_callable, const Variant** p_args, int p_arg_count, const Variant& p_result, const GDExtensionCallError& p_error) const;
     Variant get_default_variant_for_data_type(const OScriptDataType& p_type);
+    void _build_frame_layout();
+    MemberAccessCache* _get_member_access_cache(int p_index, const StringName& p_owner_class, const StringName& p_property, bool p_setter);
+    bool _has_breakpoints();
+    Ref<OScriptFunctionState> _suspend(OScriptInstance* p_instance, const Signal& p_completed, Variant* p_stack, uint32_t p_alloca_size, int p_ip, int p_node, int p_defarg);
+    void _release_state_stack(Vector<uint8_t>& r_stack);
+    static bool _resolve_operator_cache(OperatorCache& r_cache, Variant::Operator p_operator, Variant::Type p_left, Variant::Type p_right);
 
 public:
     static constexpr int MAX_CALL_DEPTH = 2048; // Limit to avoid crash because of stack overflow
@@ -426,7 +601,8 @@ public:
 
     #ifdef DEBUG_ENABLED
     void _profile_native_call(uint64_t p_t_taken, const String& p_function_name, const String& p_instance_class_name = String());
-    void disassemble(const Vector<String>& p_code_lines, Vector<String>& r_output) const;
+    void disassemble(const Vector<String>& p_code_lines, Vector<String>& r_output, bool p_unoptimized = false) const;
+    _FORCE_INLINE_ bool is_optimized() const { return !unoptimized_code.is_empty(); }
     #endif
 
     String to_string();
@@ -188,6 +188,15 @@ bool OScriptCompiler::is_local_or_parameter(CompilerContext& p_context, const St
     return p_context.parameters.has(p_name) || p_context.locals.has(p_name);
 }
 
+bool OScriptCompiler::is_class_member_function(CompilerContext& p_context, const StringName& p_name) {
+    if (!p_context.class_node || !p_context.class_node->has_member(p_name)) {
+        return false;
+    }
+
+    const OScriptParser::ClassNode::Member& member = p_context.class_node->get_member(p_name);
+    return member.type == OScriptParser::ClassNode::Member::FUNCTION && !member.function->is_static;
+}
+
 bool OScriptCompiler::has_utility_function(const StringName& p_name) {
     return ExtensionDB::is_utility_function(p_name);
 }
@@ -444,6 +453,9 @@ OScriptCompiledFunction* OScriptCompiler::parse_function(Error& r_error, OScript
     bool is_initializer = p_func && !p_for_lambda && p_func->identifier->name == OScriptLanguage::get_singleton()->strings._init;
     bool is_implicit_ready = !p_func && p_for_ready;
 
+    // Whether `@implicit_new()` initializes anything not already covered by the default member image.
+    bool has_implicit_initialization = false;
+
     if (!p_for_lambda && is_implicit_initializer) {
         // Initialize the default values for typed variables before anything.
         // This avoids crashes if they are accessed with validated calls before being properly initialized.
@@ -459,16 +471,25 @@ OScriptCompiledFunction* OScriptCompiler::parse_function(Error& r_error, OScript
             }
 
             OScriptDataType type = resolve_type(field->get_datatype(), context.script);
+            Variant constant_default;
+            if (get_constant_member_default(field, type, constant_default)) {
+                // Set by the default member image instead
+                continue;
+            }
+
             if (type.has_type()) {
                 context.generator->write_newline(field->script_node_id);
                 OScriptCodeGenerator::Address dst_addr(OScriptCodeGenerator::Address::MEMBER, context.script->member_indices[field->identifier->name].index, type);
 
                 if (type.builtin_type == Variant::ARRAY && type.has_container_element_types()) {
                     context.generator->write_construct_typed_array(dst_addr, type.get_container_element_type(0), Vector<OScriptCodeGenerator::Address>());
+                    has_implicit_initialization = true;
                 } else if (type.builtin_type == Variant::DICTIONARY && type.has_container_element_types()) {
                     context.generator->write_construct_typed_dictionary(dst_addr, type.get_container_element_type_or_variant(0), type.get_container_element_type_or_variant(1), Vector<OScriptCodeGenerator::Address>());
+                    has_implicit_initialization = true;
                 } else if (type.kind == OScriptDataType::BUILTIN) {
                     context.generator->write_construct(dst_addr, type.builtin_type, Vector<OScriptCodeGenerator::Address>());
+                    has_implicit_initialization = true;
                 } else {
                     // Objects and such, left as null.
                 }
@@ -494,6 +515,13 @@ OScriptCompiledFunction* OScriptCompiler::parse_function(Error& r_error, OScript
             }
 
             if (field->initializer) {
+                OScriptDataType type = resolve_type(field->get_datatype(), context.script);
+
+                Variant constant_default;
+                if (is_implicit_initializer && get_constant_member_default(field, type, constant_default)) {
+                    continue;
+                }
+
                 context.generator->write_newline(field->initializer->script_node_id);
 
                 OScriptCodeGenerator::Address src = parse_expression(context, r_error, field->initializer, false, true);
@@ -502,7 +530,6 @@ OScriptCompiledFunction* OScriptCompiler::parse_function(Error& r_error, OScript
                     return nullptr;
                 }
 
-                OScriptDataType type = resolve_type(field->get_datatype(), context.script);
                 OScriptCodeGenerator::Address dst(OScriptCodeGenerator::Address::MEMBER, context.script->member_indices[field->identifier->name].index, type);
 
                 if (field->use_conversion_assign) {
@@ -514,6 +541,8 @@ OScriptCompiledFunction* OScriptCompiler::parse_function(Error& r_error, OScript
                 if (src.mode == OScriptCodeGenerator::Address::TEMPORARY) {
                     context.generator->pop_temporary();
                 }
+
+                has_implicit_initialization = true;
             }
         }
     }
@@ -586,6 +615,7 @@ OScriptCompiledFunction* OScriptCompiler::parse_function(Error& r_error, OScript
         p_script->initializer = func;
     } else if (is_implicit_initializer) {
         p_script->implicit_initializer = func;
+        p_script->has_implicit_initialization = has_implicit_initialization;
     } else if (is_implicit_ready) {
         p_script->implicit_ready = func;
     }
@@ -785,6 +815,37 @@ Error OScriptCompiler::parse_block(CompilerContext& p_context, const OScriptPars
 					p_context.generator->pop_temporary();
 				}
 
+				// Matches on constant integers or strings, like those of the switch nodes, dispatch
+				// through a branch table rather than testing each case in turn.
+				Vector<Variant> branch_values;
+				if (get_switch_table_cases(match, branch_values)) {
+					generator->write_switch(value, branch_values);
+
+					for (int j = 0; j < match->branches.size(); j++) {
+						const OScriptParser::MatchBranchNode *branch = match->branches[j];
+
+						generator->write_switch_branch();
+
+						p_context.start_block();
+						List<OScriptCodeGenerator::Address> branch_locals = add_block_locals(p_context, branch->block);
+
+						generator->write_newline(branch->script_node_id);
+
+						err = parse_block(p_context, branch->block, false); // Don't add locals again.
+						if (err) {
+							return err;
+						}
+
+						clear_block_locals(p_context, branch_locals);
+						p_context.end_block();
+					}
+
+					generator->write_endswitch();
+
+					p_context.end_block(); // Get out of extra block for match's @special locals.
+					break;
+				}
+
                 // Cache the value type so it can be used for comparisons.
                 // When the value's type is statically matched (hard builtin), the typeof computation
                 // can be determined at compile-time as a constant, so that the per-execution cost of
@@ -916,11 +977,13 @@ Error OScriptCompiler::parse_block(CompilerContext& p_context, const OScriptPars
 				OScriptCodeGenerator::Address iterator = p_context.add_local(for_n->variable->name, resolve_type(for_n->variable->get_datatype(), p_context.script));
 
 				// Optimize `range()` call to not allocate an array.
+				// The ForLoop and ForEach nodes lower to `_oscript_internal_range`, which has the same semantics.
 				OScriptParser::CallNode *range_call = nullptr;
 				if (for_n->list && for_n->list->type == OScriptParser::Node::CALL) {
 					OScriptParser::CallNode *call = static_cast<OScriptParser::CallNode *>(for_n->list);
 					if (call->get_callee_type() == OScriptParser::Node::IDENTIFIER) {
-						if (static_cast<OScriptParser::IdentifierNode *>(call->callee)->name == StringName("range")) {
+						const StringName& callee_name = static_cast<OScriptParser::IdentifierNode *>(call->callee)->name;
+						if (callee_name == StringName("range") || callee_name == StringName("_oscript_internal_range")) {
 							range_call = call;
 						}
 					}
@@ -1593,10 +1656,10 @@ OScriptCodeGenerator::Address OScriptCompiler::parse_expression(CompilerContext&
 						    MethodBind* method = ClassDB::get_method(p_context.script->native->get_name(), call->function_name);
 							if (can_use_validate_call(method, arguments)) {
 								// Exact arguments, use validated call.
-								generator->write_call_method_bind_validated(result, self, method, arguments);
+								generator->write_call_method_bind_validated(result, self, method, p_context.script->native->get_name(), call->function_name, arguments);
 							} else {
 								// Not exact arguments, but still can use method bind call.
-								generator->write_call_method_bind(result, self, method, arguments);
+								generator->write_call_method_bind(result, self, method, p_context.script->native->get_name(), call->function_name, arguments);
 							}
 						    #else
 						    generator->write_call(result, self, call->function_name, arguments);
@@ -1612,6 +1675,9 @@ OScriptCodeGenerator::Address OScriptCompiler::parse_expression(CompilerContext&
 						} else {
 							if (is_awaited) {
 								generator->write_call_self_async(result, call->function_name, arguments);
+							} else if (is_class_member_function(p_context, call->function_name)) {
+								// Function declared by this script, the callee is linked after the class compiles.
+								generator->write_call_oscript_function(result, call->function_name, arguments);
 							} else {
 								generator->write_call_self(result, call->function_name, arguments);
 							}
@@ -1633,7 +1699,7 @@ OScriptCodeGenerator::Address OScriptCompiler::parse_expression(CompilerContext&
 								MethodBind *method = ClassDB::get_method(class_name, subscript->attribute->name);
 								if (can_use_validate_call(method, arguments)) {
 									// Exact arguments, use validated call.
-									generator->write_call_native_static_validated(result, method, arguments);
+									generator->write_call_native_static_validated(result, method, class_name, subscript->attribute->name, arguments);
 								} else {
 									// Not exact arguments, use regular static call
 									generator->write_call_native_static(result, class_name, subscript->attribute->name, arguments);
@@ -1662,10 +1728,10 @@ OScriptCodeGenerator::Address OScriptCompiler::parse_expression(CompilerContext&
 										MethodBind *method = ClassDB::get_method(class_name, call->function_name);
 										if (can_use_validate_call(method, arguments)) {
 											// Exact arguments, use validated call.
-											generator->write_call_method_bind_validated(result, base, method, arguments);
+											generator->write_call_method_bind_validated(result, base, method, class_name, call->function_name, arguments);
 										} else {
 											// Not exact arguments, but still can use method bind call.
-											generator->write_call_method_bind(result, base, method, arguments);
+											generator->write_call_method_bind(result, base, method, class_name, call->function_name, arguments);
 										}
 									} else {
 										generator->write_call(result, base, call->function_name, arguments);
@@ -1705,14 +1771,19 @@ OScriptCodeGenerator::Address OScriptCompiler::parse_expression(CompilerContext&
         case OScriptParser::Node::GET_NODE: {
 			const OScriptParser::GetNodeNode *get_node = static_cast<const OScriptParser::GetNodeNode *>(p_expression);
 
-			Vector<OScriptCodeGenerator::Address> args;
-			args.push_back(p_context.add_constant(NodePath(get_node->full_path)));
+			// Each distinct path gets one slot per script, shared by all of its functions, so that the
+			// instance resolves the node once rather than walking the path on every evaluation.
+			HashMap<String, int>& slots = scene_node_slots[p_context.script];
+			if (!slots.has(get_node->full_path)) {
+				const int slot = slots.size();
+				slots[get_node->full_path] = slot;
+			}
 
+			OScriptCodeGenerator::Address path = p_context.add_constant(NodePath(get_node->full_path));
 			OScriptCodeGenerator::Address result = p_context.add_temporary(resolve_type(get_node->get_datatype(), p_context.script));
 
             stamp_provenance();
-			MethodBind *get_node_method = ClassDB::get_method("Node", "get_node");
-			generator->write_call_method_bind_validated(result, OScriptCodeGenerator::Address(OScriptCodeGenerator::Address::SELF), get_node_method, args);
+			generator->write_get_scene_node(result, path, slots[get_node->full_path]);
 
 			return result;
 		}
@@ -1735,7 +1806,11 @@ OScriptCodeGenerator::Address OScriptCompiler::parse_expression(CompilerContext&
 			}
 
             stamp_provenance();
-			generator->write_await(result, argument);
+			if (await->is_delay) {
+				generator->write_await_delay(result, argument);
+			} else {
+				generator->write_await(result, argument);
+			}
 
 			if (argument.mode == OScriptCodeGenerator::Address::TEMPORARY) {
 				generator->pop_temporary();
@@ -2413,6 +2488,71 @@ OScriptCodeGenerator::Address OScriptCompiler::parse_expression(CompilerContext&
     }
 }
 
+bool OScriptCompiler::get_switch_table_cases(const OScriptParser::MatchNode* p_match, Vector<Variant>& r_branch_values) const {
+    // Below this, testing each case in turn is as fast as the table lookup.
+    constexpr int MIN_TABLE_CASES = 4;
+
+    Variant::Type table_type = Variant::NIL;
+    int case_count = 0;
+
+    r_branch_values.clear();
+    for (const OScriptParser::MatchBranchNode* branch : p_match->branches) {
+        if (branch->guard_body || branch->patterns.size() != 1) {
+            return false;
+        }
+
+        const OScriptParser::PatternNode* pattern = branch->patterns[0];
+        Variant value;
+        switch (pattern->pattern_type) {
+            case OScriptParser::PatternNode::PT_WILDCARD: {
+                r_branch_values.push_back(Variant());
+                continue;
+            }
+            case OScriptParser::PatternNode::PT_LITERAL: {
+                value = pattern->literal->value;
+                break;
+            }
+            case OScriptParser::PatternNode::PT_EXPRESSION: {
+                // Expressions compare String and StringName asymmetrically, only integers are safe.
+                if (!pattern->expression->is_constant || pattern->expression->reduced_value.get_type() != Variant::INT) {
+                    return false;
+                }
+                value = pattern->expression->reduced_value;
+                break;
+            }
+            default: {
+                return false;
+            }
+        }
+
+        Variant::Type type;
+        switch (value.get_type()) {
+            case Variant::INT: {
+                type = Variant::INT;
+                break;
+            }
+            case Variant::STRING:
+            case Variant::STRING_NAME: {
+                type = Variant::STRING;
+                break;
+            }
+            default: {
+                return false;
+            }
+        }
+
+        if (table_type != Variant::NIL && table_type != type) {
+            return false;
+        }
+
+        table_type = type;
+        case_count++;
+        r_branch_values.push_back(value);
+    }
+
+    return case_count >= MIN_TABLE_CASES;
+}
+
 OScriptCodeGenerator::Address OScriptCompiler::parse_match_pattern(CompilerContext& p_context, Error& r_error, const OScriptParser::PatternNode* p_pattern, const OScriptCodeGenerator::Address& p_value_addr, const OScriptCodeGenerator::Address& p_type_addr, const OScriptCodeGenerator::Address& p_prev_test, bool p_is_first, bool p_is_nested) {
     switch (p_pattern->pattern_type) {
         case OScriptParser::PatternNode::PT_LITERAL: {
@@ -2898,11 +3038,13 @@ Error OScriptCompiler::prepare_compilation(OScript* p_script, const OScriptParse
 
     p_script->member_functions.clear();
     p_script->member_indices.clear();
+    p_script->member_default_image.clear();
     p_script->static_variables_indices.clear();
     p_script->static_variables.clear();
     p_script->signals.clear();
     p_script->initializer = nullptr;
     p_script->implicit_initializer = nullptr;
+    p_script->has_implicit_initialization = false;
     p_script->implicit_ready = nullptr;
     p_script->static_initializer = nullptr;
     p_script->rpc_config.clear();
@@ -2974,6 +3116,7 @@ Error OScriptCompiler::prepare_compilation(OScript* p_script, const OScriptParse
 
             p_script->base = base;
             p_script->member_indices = base->member_indices;
+            p_script->member_default_image = base->member_default_image;
             break;
         }
         default: {
@@ -3068,6 +3211,12 @@ Error OScriptCompiler::prepare_compilation(OScript* p_script, const OScriptParse
                     minfo.index = p_script->member_indices.size();
                     p_script->member_indices[name] = minfo;
                     p_script->members.insert(name);
+
+                    p_script->member_default_image.resize(p_script->member_indices.size());
+                    Variant constant_default;
+                    if (get_constant_member_default(variable, minfo.data_type, constant_default)) {
+                        p_script->member_default_image.write[minfo.index] = constant_default;
+                    }
                 }
 
                 #ifdef TOOLS_ENABLED
@@ -3221,6 +3370,9 @@ Error OScriptCompiler::compile_class(OScript* p_script, const OScriptParser::Cla
         }
     }
 
+    link_oscript_functions(p_script);
+    p_script->_update_member_indices_snapshot();
+
     #ifdef DEBUG_ENABLED
     if (p_keep_state) {
         for (RBSet<Object*>::Element* E = p_script->instances.front(); E;) {
@@ -3236,14 +3388,12 @@ Error OScriptCompiler::compile_class(OScript* p_script, const OScriptParser::Cla
 
                     p_script->_instance_create(E->get());
                     OScriptInstance* si = static_cast<OScriptInstance*>(p_script->instance_script_instances[E->get()]);
-                    si->_members.resize(p_script->member_indices.size());
+                    si->_members = p_script->member_default_image;
                     si->_script = Ref<OScript>(p_script);
                     si->_owner = E->get();
 
                     // Hot reloading
-                    for (const KeyValue<StringName, OScript::MemberInfo>& F : p_script->member_indices) {
-                        si->_member_indices_cache[F.key] = F.value.index;
-                    }
+                    si->_member_indices_cache = p_script->member_indices_snapshot;
 
                     GDExtensionCallError error;
                     p_script->initializer->call(si, nullptr, 0, error);
@@ -3286,6 +3436,32 @@ Error OScriptCompiler::compile_class(OScript* p_script, const OScriptParser::Cla
     return OK;
 }
 
+void OScriptCompiler::link_oscript_functions(OScript* p_script) {
+    // Resolves OPCODE_CALL_OSCRIPT_FUNCTION targets to this script's compiled functions. Callers and
+    // callees are owned by the same script, so they're released together when it's recompiled or
+    // cleared. Unresolved entries stay null and the VM dispatches those calls by name.
+    List<OScriptCompiledFunction*> functions;
+    for (const KeyValue<StringName, OScriptCompiledFunction*>& E : p_script->member_functions) {
+        functions.push_back(E.value);
+    }
+    for (const KeyValue<OScriptCompiledFunction*, OScript::LambdaInfo>& E : p_script->lambda_info) {
+        functions.push_back(E.key);
+    }
+    if (p_script->implicit_initializer) {
+        functions.push_back(p_script->implicit_initializer);
+    }
+    if (p_script->implicit_ready) {
+        functions.push_back(p_script->implicit_ready);
+    }
+
+    for (OScriptCompiledFunction* function : functions) {
+        for (int i = 0; i < function->oscript_functions_count; i++) {
+            HashMap<StringName, OScriptCompiledFunction*>::ConstIterator E = p_script->member_functions.find(function->oscript_function_names[i]);
+            function->oscript_functions_ptr[i] = E && !E->value->is_static() ? E->value : nullptr;
+        }
+    }
+}
+
 void OScriptCompiler::convert_to_initializer_type(Variant& p_variant, const OScriptParser::VariableNode* p_node) {
     // Set p_variant to the value of p_node's initializer, with the type of p_node's variable.
     OScriptParser::DataType member_t = p_node->data_type;
@@ -3302,6 +3478,28 @@ void OScriptCompiler::convert_to_initializer_type(Variant& p_variant, const OScr
     }
 }
 
+bool OScriptCompiler::get_constant_member_default(const OScriptParser::VariableNode* p_variable, const OScriptDataType& p_type, Variant& r_value) {
+    if (!p_variable->initializer || !p_variable->initializer->is_constant || p_variable->onready || p_variable->is_static) {
+        return false;
+    }
+
+    r_value = p_variable->initializer->reduced_value;
+    if (p_variable->use_conversion_assign) {
+        convert_to_initializer_type(r_value, p_variable);
+    }
+
+    // Only value types, the image is copied into each instance and references would be shared
+    if (r_value.get_type() >= Variant::OBJECT) {
+        return false;
+    }
+
+    if (p_type.has_type()) {
+        return p_type.kind == OScriptDataType::BUILTIN && p_type.builtin_type == r_value.get_type();
+    }
+
+    return true;
+}
+
 void OScriptCompiler::make_scripts(OScript* p_script, const OScriptParser::ClassNode* p_class, bool p_keep_state) {
     ERR_FAIL_NULL(p_script);
     ERR_FAIL_NULL(p_class);
@@ -3355,6 +3553,7 @@ Error OScriptCompiler::compile(const OScriptParser* p_parser, OScript* p_script,
 
     parser = p_parser;
     main_script = p_script;
+    scene_node_slots.clear();
 
     const OScriptParser::ClassNode* root = parser->get_tree();
     ERR_FAIL_NULL_V(root, ERR_COMPILATION_FAILED);
@@ -32,6 +32,7 @@ class OScriptCompiler {
     HashSet<OScript*> parsed_classes;
     HashSet<OScript*> parsing_classes;
     OScript* main_script = nullptr;
+    HashMap<const OScript*, HashMap<String, int>> scene_node_slots; // Per-instance cache slots of scene node paths, by script
 
     struct CompilerContext {
         OScript* script = nullptr;
@@ -62,6 +63,7 @@ class OScriptCompiler {
     bool is_class_member_property(CompilerContext& p_context, const StringName& p_name);
     bool is_class_member_property(OScript* p_owner, const StringName& p_name);
     bool is_local_or_parameter(CompilerContext& p_context, const StringName& p_name);
+    bool is_class_member_function(CompilerContext& p_context, const StringName& p_name);
     bool has_utility_function(const StringName& p_name);
 
     void set_error(const String& p_error, const OScriptParser::Node* p_node);
@@ -79,14 +81,17 @@ class OScriptCompiler {
     Error parse_block(CompilerContext& p_context, const OScriptParser::SuiteNode* p_block, bool p_add_locals = true, bool p_clear_locals = true);
 
     OScriptCodeGenerator::Address parse_expression(CompilerContext& p_context, Error& r_error, const OScriptParser::ExpressionNode* p_expression, bool p_root = false, bool p_initializer = false);
+    bool get_switch_table_cases(const OScriptParser::MatchNode* p_match, Vector<Variant>& r_branch_values) const;
     OScriptCodeGenerator::Address parse_match_pattern(CompilerContext& p_context, Error& r_error, const OScriptParser::PatternNode* p_node, const OScriptCodeGenerator::Address& p_value_addr, const OScriptCodeGenerator::Address& p_type_addr, const OScriptCodeGenerator::Address& p_prev_test, bool p_is_first, bool p_is_nested);
 
     Error prepare_compilation(OScript* p_script, const OScriptParser::ClassNode* p_class, bool p_keep_state);
     Error compile_class(OScript* p_script, const OScriptParser::ClassNode* p_class, bool p_keep_state);
+    static bool get_constant_member_default(const OScriptParser::VariableNode* p_variable, const OScriptDataType& p_type, Variant& r_value);
 
 public:
     static void convert_to_initializer_type(Variant& p_variant, const OScriptParser::VariableNode* p_node);
     static void make_scripts(OScript* p_script, const OScriptParser::ClassNode* p_class, bool p_keep_state);
+    static void link_oscript_functions(OScript* p_script);
     Error compile(const OScriptParser* p_parser, OScript* p_script, bool p_keep_state = false);
 
     String get_error() const;
@@ -83,9 +83,13 @@ static String _disassemble_address(const OScript* p_script, const OScriptCompile
     return "<err>";
 }
 
-void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Vector<String>& r_output) const {
+void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Vector<String>& r_output, bool p_unoptimized) const {
     #define DADDR(m_ip) (_disassemble_address(_script,* this, code_ptr[ip + m_ip]))
 
+    // Shadows the members, so the same listing can be produced for the code before optimization.
+    const int* code_ptr = p_unoptimized ? unoptimized_code.ptr() : this->code_ptr;
+    const int code_size = p_unoptimized ? unoptimized_code.size() : this->code_size;
+
 	for (int ip = 0; ip < code_size;) {
 		String text;
 		int incr = 0;
@@ -99,7 +103,6 @@ void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Ve
 
 		switch (opcode) {
 			case OPCODE_OPERATOR: {
-				constexpr int _pointer_size = sizeof(GDExtensionPtrOperatorEvaluator) / sizeof(*code_ptr);
 				int operation = code_ptr[ip + 4];
 
 				text += "operator ";
@@ -112,7 +115,7 @@ void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Ve
 				text += " ";
 				text += DADDR(2);
 
-				incr += 7 + _pointer_size;
+				incr += 7;
 			} break;
 			case OPCODE_OPERATOR_VALIDATED: {
 				text += "validated operator ";
@@ -127,6 +130,47 @@ void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Ve
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_TYPED_OPERATOR(m_name, m_operator) \
+	case OPCODE_##m_name: {                            \
+		text += "typed operator (";                    \
+		text += #m_name;                               \
+		text += ") ";                                  \
+		text += DADDR(3);                              \
+		text += " = ";                                 \
+		text += DADDR(1);                              \
+		text += " " m_operator " ";                    \
+		text += DADDR(2);                              \
+		incr += 4;                                     \
+	} break
+
+				DISASSEMBLE_TYPED_OPERATOR(ADD_INT_INT, "+");
+				DISASSEMBLE_TYPED_OPERATOR(SUB_INT_INT, "-");
+				DISASSEMBLE_TYPED_OPERATOR(MUL_INT_INT, "*");
+				DISASSEMBLE_TYPED_OPERATOR(EQUAL_INT_INT, "==");
+				DISASSEMBLE_TYPED_OPERATOR(NOT_EQUAL_INT_INT, "!=");
+				DISASSEMBLE_TYPED_OPERATOR(LESS_INT_INT, "<");
+				DISASSEMBLE_TYPED_OPERATOR(LESS_EQUAL_INT_INT, "<=");
+				DISASSEMBLE_TYPED_OPERATOR(GREATER_INT_INT, ">");
+				DISASSEMBLE_TYPED_OPERATOR(GREATER_EQUAL_INT_INT, ">=");
+				DISASSEMBLE_TYPED_OPERATOR(ADD_FLOAT_FLOAT, "+");
+				DISASSEMBLE_TYPED_OPERATOR(SUB_FLOAT_FLOAT, "-");
+				DISASSEMBLE_TYPED_OPERATOR(MUL_FLOAT_FLOAT, "*");
+				DISASSEMBLE_TYPED_OPERATOR(DIV_FLOAT_FLOAT, "/");
+				DISASSEMBLE_TYPED_OPERATOR(LESS_FLOAT_FLOAT, "<");
+				DISASSEMBLE_TYPED_OPERATOR(LESS_EQUAL_FLOAT_FLOAT, "<=");
+				DISASSEMBLE_TYPED_OPERATOR(GREATER_FLOAT_FLOAT, ">");
+				DISASSEMBLE_TYPED_OPERATOR(GREATER_EQUAL_FLOAT_FLOAT, ">=");
+				DISASSEMBLE_TYPED_OPERATOR(ADD_VECTOR2_VECTOR2, "+");
+				DISASSEMBLE_TYPED_OPERATOR(SUB_VECTOR2_VECTOR2, "-");
+				DISASSEMBLE_TYPED_OPERATOR(MUL_VECTOR2_VECTOR2, "*");
+				DISASSEMBLE_TYPED_OPERATOR(MUL_VECTOR2_FLOAT, "*");
+				DISASSEMBLE_TYPED_OPERATOR(DIV_VECTOR2_FLOAT, "/");
+				DISASSEMBLE_TYPED_OPERATOR(ADD_VECTOR3_VECTOR3, "+");
+				DISASSEMBLE_TYPED_OPERATOR(SUB_VECTOR3_VECTOR3, "-");
+				DISASSEMBLE_TYPED_OPERATOR(MUL_VECTOR3_VECTOR3, "*");
+				DISASSEMBLE_TYPED_OPERATOR(MUL_VECTOR3_FLOAT, "*");
+				DISASSEMBLE_TYPED_OPERATOR(DIV_VECTOR3_FLOAT, "/");
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -335,7 +379,7 @@ void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Ve
 				text += "\"] = ";
 				text += DADDR(1);
 
-				incr += 3;
+				incr += 4;
 			} break;
 			case OPCODE_GET_MEMBER: {
 				text += "get_member ";
@@ -345,7 +389,7 @@ void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Ve
 				text += global_names_ptr[code_ptr[ip + 2]];
 				text += "\"]";
 
-				incr += 3;
+				incr += 4;
 			} break;
 			case OPCODE_SET_STATIC_VARIABLE: {
 				Ref<OScript> gdscript;
@@ -389,6 +433,17 @@ void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Ve
 
 				incr += 4;
 			} break;
+			case OPCODE_GET_SCENE_NODE: {
+				text += "get_scene_node ";
+				text += DADDR(1);
+				text += " = ";
+				text += DADDR(2);
+				text += " (slot ";
+				text += itos(code_ptr[ip + 3]);
+				text += ")";
+
+				incr += 4;
+			} break;
 			case OPCODE_ASSIGN: {
 				text += "assign ";
 				text += DADDR(1);
@@ -970,12 +1025,47 @@ void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Ve
 
 				incr = 4 + argc;
 			} break;
+			case OPCODE_CALL_OSCRIPT_FUNCTION:
+			case OPCODE_CALL_OSCRIPT_FUNCTION_RETURN: {
+				bool ret = (code_ptr[ip]) == OPCODE_CALL_OSCRIPT_FUNCTION_RETURN;
+				int instr_var_args = code_ptr[++ip];
+
+				text += ret ? "call-oscript-ret " : "call-oscript ";
+
+				int argc = code_ptr[ip + 1 + instr_var_args];
+				if (ret) {
+					text += DADDR(1 + argc) + " = ";
+				}
+
+				text += global_names_ptr[code_ptr[ip + 2 + instr_var_args]];
+				text += "(";
+
+				for (int i = 0; i < argc; i++) {
+					if (i > 0) {
+						text += ", ";
+					}
+					text += DADDR(1 + i);
+				}
+				text += ")";
+
+				if (!oscript_functions_ptr[code_ptr[ip + 3 + instr_var_args]]) {
+					text += " (unlinked)";
+				}
+
+				incr = 5 + argc;
+			} break;
 			case OPCODE_AWAIT: {
 				text += "await ";
 				text += DADDR(1);
 
 				incr = 2;
 			} break;
+			case OPCODE_AWAIT_DELAY: {
+				text += "await delay ";
+				text += DADDR(1);
+
+				incr = 2;
+			} break;
 			case OPCODE_AWAIT_RESUME: {
 				text += "await resume ";
 				text += DADDR(1);
@@ -1057,6 +1147,30 @@ void OScriptCompiledFunction::disassemble(const Vector<String>& p_code_lines, Ve
 
 				incr = 3;
 			} break;
+			case OPCODE_SWITCH: {
+				text += "switch ";
+				text += DADDR(1);
+				text += " table ";
+				text += itos(code_ptr[ip + 2]);
+
+				// Table targets are positions in the optimized code
+				if (!p_unoptimized) {
+					const SwitchTable& table = switch_tables_ptr[code_ptr[ip + 2]];
+					text += " [";
+					for (int i = 0; i < table.values.size(); i++) {
+						if (i > 0) {
+							text += ", ";
+						}
+						text += table.values[i].stringify();
+						text += ": ";
+						text += itos(table.targets[table.value_branches[i]]);
+					}
+					text += "] default ";
+					text += itos(table.targets[table.default_branch >= 0 ? table.default_branch : table.targets.size() - 1]);
+				}
+
+				incr = 3;
+			} break;
 			case OPCODE_RETURN: {
 				text += "return ";
 				text += DADDR(1);
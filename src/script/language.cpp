@@ -41,12 +41,16 @@
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/packed_scene.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/classes/window.hpp>
 #include <godot_cpp/core/mutex_lock.hpp>
 
 OScriptLanguage* OScriptLanguage::_singleton = nullptr;
 
 thread_local OScriptLanguage::CallLevel* OScriptLanguage::_call_stack = nullptr;
 thread_local uint32_t OScriptLanguage::_call_stack_size = 0;
+thread_local uint32_t OScriptLanguage::_debug_poll_count = 0;
 thread_local StringPtr OScriptLanguage::_debug_parse_err_file = StringPtr();
 thread_local int OScriptLanguage::_debug_parse_err_line = 0;
 thread_local StringPtr OScriptLanguage::_debug_error = StringPtr();
@@ -122,6 +126,7 @@ void OScriptLanguage::_init() {
     _debug_max_call_stack = ORCHESTRATOR_GET("debug/settings/max_call_stack", 1024);
     track_call_stack = ORCHESTRATOR_GET("debug/settings/always_track_call_stacks", false);
     track_locals = ORCHESTRATOR_GET("debug/settings/always_track_local_variables", false);
+    optimize_bytecode = ORCHESTRATOR_GET("debug/settings/optimize_bytecode", false);
     _call_stack = nullptr;
 
     #if DEBUG_ENABLED
@@ -131,6 +136,12 @@ void OScriptLanguage::_init() {
     track_locals = track_locals || EngineDebugger::get_singleton()->is_active();
     #endif
 
+    debug_refresh_state();
+
+    if (EngineDebugger* debugger = EngineDebugger::get_singleton()) {
+        debugger->register_message_capture("orchestrator", callable_mp(this, &OScriptLanguage::_debug_capture));
+    }
+
     const String storage_format = ORCHESTRATOR_GET("editor/settings/storage_format", "Text");
     if (storage_format.match("Binary")) {
         _extension = ORCHESTRATOR_SCRIPT_EXTENSION;
@@ -181,6 +192,20 @@ void OScriptLanguage::_finish() {
 
     finishing = true;
 
+    if (EngineDebugger* debugger = EngineDebugger::get_singleton()) {
+        if (debugger->has_capture("orchestrator")) {
+            debugger->unregister_message_capture("orchestrator");
+        }
+    }
+
+    // Released outside the lock, as freeing a coroutine's stack may release arbitrary objects.
+    LocalVector<DelayedResume> delays;
+    {
+        MutexLock delay_lock(*_delay_lock.ptr());
+        SWAP(delays, _delays);
+    }
+    delays.clear();
+
     OScriptCache::clear();
 
     SelfList<OScript> *s = _scripts.first();
@@ -735,8 +760,10 @@ void OScriptLanguage::_profiling_start() {
         elem->self()->profile.last_frame_total_time = 0;
         elem->self()->profile.native_calls.clear();
         elem->self()->profile.last_native_calls.clear();
+        elem->self()->_start_node_profiles();
         elem = elem->next();
     }
+    node_profile_last_sent = 0;
     profiling = true;
     #endif
 }
@@ -745,6 +772,9 @@ void OScriptLanguage::_profiling_stop() {
     #ifdef DEBUG_ENABLED
     MutexLock function_lock(*lock.ptr());
     profiling = false;
+
+    // Sends the final totals, which the editor keeps showing after the profiler stops.
+    _send_node_profiles();
     #endif
 }
 
@@ -837,7 +867,127 @@ int32_t OScriptLanguage::_profiling_get_frame_data(ScriptLanguageExtensionProfil
     return current;
 }
 
+void OScriptLanguage::_process_delays() {
+    // Like the scene tree timers this replaces, the clock advances by the scene tree's process delta,
+    // which is already time scaled, rather than by wall clock time.
+    double delta = 0;
+    if (SceneTree* tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop())) {
+        if (Window* root = tree->get_root()) {
+            delta = root->get_process_delta_time();
+        }
+    }
+
+    LocalVector<Ref<OScriptFunctionState>> due;
+    {
+        MutexLock delay_lock(*_delay_lock.ptr());
+        _delay_clock += delta;
+
+        while (!_delays.is_empty() && _delays[0].due <= _delay_clock) {
+            due.push_back(_delays[0].state);
+
+            // Pop the heap's root by moving the last entry there and sifting it down.
+            const uint32_t size = _delays.size() - 1;
+            _delays[0] = _delays[size];
+            _delays.resize(size);
+
+            uint32_t hole = 0;
+            while (true) {
+                const uint32_t left = hole * 2 + 1;
+                if (left >= size) {
+                    break;
+                }
+                const uint32_t right = left + 1;
+                const uint32_t child = (right < size && _delays[right] < _delays[left]) ? right : left;
+                if (!(_delays[child] < _delays[hole])) {
+                    break;
+                }
+                SWAP(_delays[child], _delays[hole]);
+                hole = child;
+            }
+        }
+    }
+
+    // Resumed outside the lock, since a resumed coroutine may schedule another delay. A coroutine
+    // whose script or instance is gone is dropped, as a disconnected signal would never resume it.
+    for (const Ref<OScriptFunctionState>& state : due) {
+        if (state->is_valid(true)) {
+            state->resume();
+        }
+    }
+}
+
+void OScriptLanguage::schedule_delay(const Ref<OScriptFunctionState>& p_state, double p_seconds) {
+    ERR_FAIL_COND(p_state.is_null());
+
+    MutexLock delay_lock(*_delay_lock.ptr());
+
+    DelayedResume entry;
+    entry.due = _delay_clock + MAX(p_seconds, 0.0);
+    entry.sequence = _delay_sequence++;
+    entry.state = p_state;
+
+    uint32_t hole = _delays.size();
+    _delays.push_back(entry);
+    while (hole > 0) {
+        const uint32_t parent = (hole - 1) / 2;
+        if (!(_delays[hole] < _delays[parent])) {
+            break;
+        }
+        SWAP(_delays[hole], _delays[parent]);
+        hole = parent;
+    }
+}
+
+#ifdef DEBUG_ENABLED
+void OScriptLanguage::_send_node_profiles() {
+    // Expects the lock to be held.
+    EngineDebugger* debugger = EngineDebugger::get_singleton();
+    if (!debugger || !debugger->is_active()) {
+        return;
+    }
+
+    // Functions of one orchestration share node ids, so their profiles merge by source path into
+    // flat (node id, hit count, total time) triples.
+    struct NodeTotals {
+        uint64_t hit_count = 0;
+        uint64_t total_time = 0;
+    };
+    HashMap<StringName, HashMap<int, NodeTotals>> sources;
+
+    SelfList<OScriptCompiledFunction>* elem = function_list.first();
+    while (elem) {
+        const OScriptCompiledFunction::Profile& profile = elem->self()->profile;
+        for (uint32_t i = 0; i < profile.nodes.size(); i++) {
+            const uint64_t hit_count = profile.nodes[i].hit_count.get();
+            if (hit_count > 0) {
+                NodeTotals& total = sources[elem->self()->source][elem->self()->script_nodes[i]];
+                total.hit_count += hit_count;
+                total.total_time += profile.nodes[i].total_time.get();
+            }
+        }
+        elem = elem->next();
+    }
+
+    Array data;
+    for (const KeyValue<StringName, HashMap<int, NodeTotals>>& E : sources) {
+        PackedInt64Array nodes;
+        for (const KeyValue<int, NodeTotals>& N : E.value) {
+            nodes.push_back(N.key);
+            nodes.push_back(int64_t(N.value.hit_count));
+            nodes.push_back(int64_t(N.value.total_time));
+        }
+        data.push_back(String(E.key));
+        data.push_back(nodes);
+    }
+
+    debugger->send_message("orchestrator:node_profiles", data);
+}
+#endif
+
 void OScriptLanguage::_frame() {
+    debug_refresh_state();
+    _process_delays();
+
     #ifdef DEBUG_ENABLED
     if (profiling) {
         MutexLock function_lock(*lock.ptr());
@@ -853,6 +1003,12 @@ void OScriptLanguage::_frame() {
             elem->self()->profile.native_calls.clear();
             elem = elem->next();
         }
+
+        const uint64_t now = Time::get_singleton()->get_ticks_usec();
+        if (now - node_profile_last_sent >= NODE_PROFILE_SEND_INTERVAL_USEC) {
+            node_profile_last_sent = now;
+            _send_node_profiles();
+        }
     }
     #endif
 }
@@ -1046,7 +1202,7 @@ PackedStringArray OScriptLanguage::get_global_named_constant_names() const {
 }
 
 bool OScriptLanguage::debug_break(const String& p_error, bool p_allow_continue) {
-    if (EngineDebugger::get_singleton()->is_active()) {
+    if (is_debugger_active()) {
         _debug_parse_err_line = -1;
         _debug_parse_err_file = "";
         _debug_error = p_error;
@@ -1057,13 +1213,16 @@ bool OScriptLanguage::debug_break(const String& p_error, bool p_allow_continue)
         // Because this is a thread local, clear the memory afterward
         _debug_parse_err_file = String();
         _debug_error = String();
+
+        // While paused, the user may have stepped or edited breakpoints
+        debug_refresh_state();
         return true;
     }
     return false;
 }
 
 bool OScriptLanguage::debug_break_parse(const String& p_file, int p_node, const String& p_error) {
-    if (EngineDebugger::get_singleton()->is_active())
+    if (is_debugger_active())
     {
         if (OS::get_singleton()->get_thread_caller_id() == OS::get_singleton()->get_main_thread_id())
         {
@@ -1077,12 +1236,47 @@ bool OScriptLanguage::debug_break_parse(const String& p_file, int p_node, const
             _debug_parse_err_file = String();
             _debug_error = String();
 
+            debug_refresh_state();
             return true;
         }
     }
     return false;
 }
 
+void OScriptLanguage::debug_refresh_state() {
+    EngineDebugger* debugger = EngineDebugger::get_singleton();
+    const bool active = debugger && debugger->is_active();
+
+    // Functions compare against the generation to know when to re-check their breakpoints, so it only
+    // changes when the debugger attaches or detaches, or when the editor reports a breakpoint edit.
+    if (active != debugger_active.is_set()) {
+        breakpoint_generation.increment();
+    }
+
+    debugger_active.set_to(active);
+    debugger_stepping.set_to(active && debugger->get_lines_left() > 0);
+}
+
+bool OScriptLanguage::_debug_capture(const String& p_message, const Array& p_data) {
+    // The engine applies breakpoint edits itself, the editor follows each edit with this message
+    if (p_message == "breakpoints_changed") {
+        breakpoint_generation.increment();
+        return true;
+    }
+    return false;
+}
+
+void OScriptLanguage::debug_line_poll() {
+    EngineDebugger::get_singleton()->line_poll();
+
+    // Break requests and breakpoint edits are received while polling, so scripts that run for long
+    // stretches within a single frame still pick them up.
+    if (unlikely(++_debug_poll_count >= DEBUG_STATE_POLL_INTERVAL)) {
+        _debug_poll_count = 0;
+        debug_refresh_state();
+    }
+}
+
 void OScriptLanguage::enter_function(CallLevel* p_level, OScriptInstance* p_instance, OScriptCompiledFunction* p_function, Variant* p_stack, int* p_ip, int* p_node) {
     if (!track_call_stack) {
         return;
@@ -1090,7 +1284,7 @@ void OScriptLanguage::enter_function(CallLevel* p_level, OScriptInstance* p_inst
 
     #ifdef DEBUG_ENABLED
     EngineDebugger* debugger = EngineDebugger::get_singleton();
-    if (debugger && debugger->is_active() && debugger->get_lines_left() > 0 && debugger->get_depth() >= 0) {
+    if (debugger && is_debugger_stepping() && debugger->get_depth() >= 0) {
         debugger->set_depth(debugger->get_depth() + 1);
     }
     #endif
@@ -1124,7 +1318,7 @@ void OScriptLanguage::exit_function() {
 
     #ifdef DEBUG_ENABLED
     EngineDebugger* debugger = EngineDebugger::get_singleton();
-    if (debugger && debugger->is_active() && debugger->get_lines_left() > 0 && debugger->get_depth() >= 0) {
+    if (debugger && is_debugger_stepping() && debugger->get_depth() >= 0) {
         debugger->set_depth(debugger->get_depth() - 1);
     }
     #endif
@@ -1245,10 +1439,18 @@ bool OScriptLanguage::validate(const Ref<OScript>& p_script, const String& p_pat
         return false;
     }
 
+    return validate_orchestration(p_script->get_orchestration(), p_path, r_functions, r_warnings, r_errors);
+}
+
+bool OScriptLanguage::validate_orchestration(const Ref<Orchestration>& p_orchestration, const String& p_path, List<String>* r_functions, List<Warning>* r_warnings, List<ScriptError>* r_errors) {
+    if (!p_orchestration.is_valid()) {
+        return false;
+    }
+
     OScriptParser parser;
     OScriptAnalyzer analyzer(&parser);
 
-    Error err = parser.parse(p_script->get_orchestration().ptr(), p_path);
+    Error err = parser.parse(p_orchestration.ptr(), p_path);
     if (err == OK) {
         err = analyzer.analyze();
     }
@@ -1269,8 +1471,8 @@ bool OScriptLanguage::validate(const Ref<OScript>& p_script, const String& p_pat
         if (r_errors) {
             for (const OScriptParser::ParserError& E : parser.get_errors()) {
                 Ref<OScriptNode> node;
-                if (E.node_id >= 0 && p_script->get_orchestration()->_nodes.has(E.node_id)) {
-                    node = p_script->get_orchestration()->get_node(E.node_id);
+                if (E.node_id >= 0 && p_orchestration->_nodes.has(E.node_id)) {
+                    node = p_orchestration->get_node(E.node_id);
                 }
 
                 ScriptError error;
@@ -1285,8 +1487,8 @@ bool OScriptLanguage::validate(const Ref<OScript>& p_script, const String& p_pat
                 const OScriptParser* dependent_parser = E.value->get_parser();
                 for (const OScriptParser::ParserError& F : dependent_parser->get_errors()) {
                     Ref<OScriptNode> node;
-                    if (F.node_id >= 0 && p_script->get_orchestration()->_nodes.has(F.node_id)) {
-                        node = p_script->get_orchestration()->get_node(F.node_id);
+                    if (F.node_id >= 0 && p_orchestration->_nodes.has(F.node_id)) {
+                        node = p_orchestration->get_node(F.node_id);
                     }
 
                     ScriptError error;
@@ -1340,6 +1542,8 @@ void OScriptLanguage::_bind_methods() {
 
 OScriptLanguage::OScriptLanguage() {
     lock.instantiate();
+    func_state_lock.instantiate();
+    _delay_lock.instantiate();
 
     strings._init = StringName("_init");
     strings._static_init = StringName("_static_init");
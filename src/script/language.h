@@ -24,6 +24,8 @@
 #include <godot_cpp/classes/script.hpp>
 #include <godot_cpp/classes/script_language_extension.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/safe_refcount.hpp>
 #include <godot_cpp/templates/self_list.hpp>
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/variant/string_name.hpp>
@@ -79,27 +81,71 @@ class OScriptLanguage : public ScriptLanguageExtension {
     static thread_local StringPtr _debug_error;
     static thread_local CallLevel* _call_stack;
     static thread_local uint32_t _call_stack_size;
+    static thread_local uint32_t _debug_poll_count;
     uint32_t _debug_max_call_stack = 0;
 
+    // Debugger state is cached so that the VM does not cross the engine boundary on every node.
+    // The engine does not notify script languages about break requests, so this state is refreshed
+    // each frame, after each debug break, and periodically while polling. Breakpoint edits are
+    // reported by the editor plugin through the "orchestrator" debugger message capture.
+    static constexpr uint32_t DEBUG_STATE_POLL_INTERVAL = 256;
+    SafeFlag debugger_active;
+    SafeFlag debugger_stepping;
+    SafeNumeric<uint64_t> breakpoint_generation;
+
     bool track_call_stack = false;
     bool track_locals = false;
+    bool optimize_bytecode = false;
 
     static CallLevel* _get_stack_level(uint32_t p_level);
 
+    bool _debug_capture(const String& p_message, const Array& p_data);
+
     void _add_global(const StringName& p_name, const Variant& p_value);
     void _remove_global(const StringName& p_name);
 
     Ref<Mutex> lock;
 
+    // Guards the pending function state lists of scripts and instances, along with the stack pools
+    // of compiled functions, so that awaits and resumes don't contend with the language's lock.
+    Ref<Mutex> func_state_lock;
+
     SelfList<OScript>::List _scripts;
     SelfList<OScriptCompiledFunction>::List function_list;
     #ifdef DEBUG_ENABLED
     bool profiling;
     bool profile_native_calls;
     uint64_t script_frame_time;
+
+    // Node profiles are sent to the editor periodically rather than each frame, as the heatmap
+    // shows accumulated totals.
+    static constexpr uint64_t NODE_PROFILE_SEND_INTERVAL_USEC = 500000;
+    uint64_t node_profile_last_sent = 0;
+
+    void _send_node_profiles();
     #endif
 
     HashMap<String, ObjectID> orphan_subclasses;
+
+    // Coroutines suspended by a Delay node, held in a min-heap ordered by due time and then by the
+    // order they were scheduled. The clock advances by the scaled frame time, like a scene tree
+    // timer that processes while paused, and due coroutines are resumed from the frame hook.
+    struct DelayedResume {
+        double due = 0;
+        uint64_t sequence = 0;
+        Ref<OScriptFunctionState> state;
+
+        _FORCE_INLINE_ bool operator<(const DelayedResume& p_other) const {
+            return due == p_other.due ? sequence < p_other.sequence : due < p_other.due;
+        }
+    };
+
+    Ref<Mutex> _delay_lock;
+    LocalVector<DelayedResume> _delays;
+    uint64_t _delay_sequence = 0;
+    double _delay_clock = 0;
+
+    void _process_delays();
     String _extension = ORCHESTRATOR_SCRIPT_TEXT_EXTENSION;
 
 protected:
@@ -193,6 +239,10 @@ public:
 
     _FORCE_INLINE_ bool should_track_call_stack() const { return track_call_stack; }
     _FORCE_INLINE_ bool should_track_locals() const { return track_locals; }
+    _FORCE_INLINE_ bool should_optimize_bytecode() const { return optimize_bytecode; }
+    _FORCE_INLINE_ bool is_debugger_active() const { return debugger_active.is_set(); }
+    _FORCE_INLINE_ bool is_debugger_stepping() const { return debugger_stepping.is_set(); }
+    _FORCE_INLINE_ uint64_t get_breakpoint_generation() const { return breakpoint_generation.get(); }
     _FORCE_INLINE_ int get_global_array_size() const { return global_array.size(); }
     _FORCE_INLINE_ Variant* get_global_array() { return _global_array; }
     _FORCE_INLINE_ const HashMap<StringName, int>& get_global_map() const { return globals; }
@@ -211,12 +261,19 @@ public:
     // Debugging
     bool debug_break(const String& p_error, bool p_allow_continue = true);
     bool debug_break_parse(const String& p_file, int p_node, const String& p_error);
+    void debug_refresh_state();
+    void debug_line_poll();
     void enter_function(CallLevel* p_level, OScriptInstance* p_instance, OScriptCompiledFunction* p_function, Variant* p_stack, int* p_ip, int* p_node);
     void exit_function();
 
     // Profiling
     void profiling_collate_native_call_data(bool p_accumulated);
 
+    /// Resumes a suspended coroutine once the given time has elapsed.
+    /// @param p_state the coroutine state
+    /// @param p_seconds the delay in seconds, resumed no sooner than the next frame
+    void schedule_delay(const Ref<OScriptFunctionState>& p_state, double p_seconds);
+
     Ref<OScript> get_script_by_fully_qualified_name(const String& p_name);
     String get_script_extension_filter() const;
 
@@ -232,6 +289,10 @@ public:
 
     bool validate(const Ref<OScript>& p_script, const String& p_path, List<String>* r_functions = nullptr, List<Warning>* r_warnings = nullptr, List<ScriptError>* r_errors = nullptr);
 
+    /// Validates an orchestration. This does not touch the language's state, so it may be called from
+    /// a worker thread as long as the orchestration is not modified concurrently, e.g. a snapshot.
+    bool validate_orchestration(const Ref<Orchestration>& p_orchestration, const String& p_path, List<String>* r_functions = nullptr, List<Warning>* r_warnings = nullptr, List<ScriptError>* r_errors = nullptr);
+
     OScriptLanguage();
     ~OScriptLanguage() override;
 };
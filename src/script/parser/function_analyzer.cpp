@@ -20,6 +20,7 @@
 #include "core/godot/variant/array.h"
 #include "orchestration/node_pin.h"
 #include "orchestration/nodes.h"
+#include "script/parser/pin_connections.h"
 
 #include <functional>
 
@@ -184,10 +185,11 @@ const Vector<Ref<OScriptNode>>& OScriptFunctionAnalyzer::Context::get_control_fl
     // Build directly into the cache slot to avoid an extra copy.
     Vector<Ref<OScriptNode>>& successors = control_flow_successors[id];
     for (const Ref<OScriptNodePin>& output : p_node->find_pins(PD_Output)) {
-        if (output.is_valid() && output->is_execution() && output->has_any_connections()) {
-            const Ref<OScriptNodePin> target = output->get_resolved_connection();
-            if (target.is_valid()) {
-                successors.push_back(target->get_owning_node());
+        OScriptNodePinId target;
+        if (output.is_valid() && output->is_execution() && connections->get_resolved_connection(id, output->get_pin_index(), PD_Output, target)) {
+            const Ref<OScriptNode> target_node = connections->get_node(target.node);
+            if (target_node.is_valid()) {
+                successors.push_back(target_node);
             }
         }
     }
@@ -291,16 +293,17 @@ void OScriptFunctionAnalyzer::_register_incoming_nets(Context& p_context, const
         return;
     }
 
-    for (const Ref<OScriptNodePin>& source_pin : p_pin->get_resolved_connections()) {
-        const Ref<OScriptNode> source_node = source_pin->get_owning_node();
+    const NodeId pin_node_id = p_pin->get_owning_node()->get_id();
+    for (const OScriptNodePinId& source : p_context.connections->get_resolved_connections(pin_node_id, p_pin->get_pin_index(), PD_Input)) {
+        const Ref<OScriptNode> source_node = p_context.connections->get_node(source.node);
         if (!source_node.is_valid()) {
             continue;
         }
 
-        OScriptNetKey key = { source_node->get_id(), source_pin->get_pin_index() };
+        OScriptNetKey key = { source.node, source.pin };
         if (!p_context.info.net_variable_allocation.has(key)) {
             if (const Ref<OScriptNodeFunctionEntry>& entry = source_node; entry.is_valid()) {
-                p_context.info.net_variable_allocation[key] = source_pin->get_pin_name();
+                p_context.info.net_variable_allocation[key] = source_node->find_pin(source.pin, PD_Output)->get_pin_name();
             } else if (const Ref<OScriptNodeLocalVariable>& local_var = source_node; local_var.is_valid()) {
                 String variable_name = local_var->get_variable_name();
                 if (variable_name.is_empty()) {
@@ -321,7 +324,7 @@ void OScriptFunctionAnalyzer::_register_incoming_nets(Context& p_context, const
         p_context.info.net_producers[key] = source_node->get_id();
 
         // Register consumer and inverse consumer mappings
-        const OScriptNetKey inverse_key = { p_pin->get_owning_node()->get_id(), p_pin->get_pin_index() };
+        const OScriptNetKey inverse_key = { pin_node_id, p_pin->get_pin_index() };
         p_context.info.net_consumers[key].insert(p_node_id);
         p_context.info.net_pin_consumers[inverse_key] = key;
     }
@@ -342,8 +345,8 @@ void OScriptFunctionAnalyzer::_register_nets(Context& p_context) {
             if (input.is_valid() && !input->is_execution()) {
                 _register_incoming_nets(p_context, input, node_id);
 
-                for (const Ref<OScriptNodePin>& source_pin : input->get_resolved_connections()) {
-                    const Ref<OScriptNode> source = source_pin->get_owning_node();
+                for (const OScriptNodePinId& source_id : p_context.connections->get_resolved_connections(node_id, input->get_pin_index(), PD_Input)) {
+                    const Ref<OScriptNode> source = p_context.connections->get_node(source_id.node);
                     if (source.is_valid()) {
                         visit(source);
                     }
@@ -555,11 +558,9 @@ OScriptNodePinSet OScriptFunctionAnalyzer::_get_all_reachable_pins(Context& p_co
         }
 
         for (const Ref<OScriptNodePin>& output_pin : node->find_pins(PD_Output)) {
-            if (output_pin->is_execution() && output_pin->has_any_connections()) {
-                const Ref<OScriptNodePin> target_pin = output_pin->get_resolved_connection();
-                if (target_pin.is_valid()) {
-                    DFS({ target_pin->get_owning_node()->get_id(), target_pin->get_pin_index() });
-                }
+            OScriptNodePinId target;
+            if (output_pin->is_execution() && p_context.connections->get_resolved_connection(id.node, output_pin->get_pin_index(), PD_Output, target)) {
+                DFS(target);
             }
         }
     };
@@ -570,13 +571,13 @@ OScriptNodePinSet OScriptFunctionAnalyzer::_get_all_reachable_pins(Context& p_co
 
 void OScriptFunctionAnalyzer::_collect_data_dependencies(const Ref<OScriptNode>& p_node, OScriptNodePinSet& p_dependencies, DataDependencyContext& p_context) {
     for (const Ref<OScriptNodePin>& input : p_node->find_pins(PD_Input)) {
-        if (input.is_valid() && !input->is_execution() && input->has_any_connections()) {
-            const Ref<OScriptNodePin> source_pin = input->get_resolved_connection();
-            if (!source_pin.is_valid()) {
+        OScriptNodePinId source;
+        if (input.is_valid() && !input->is_execution() && p_context.connections->get_resolved_connection(p_node->get_id(), input->get_pin_index(), PD_Input, source)) {
+            const Ref<OScriptNode> source_node = p_context.connections->get_node(source.node);
+            if (!source_node.is_valid()) {
                 continue;
             }
-            const Ref<OScriptNode> source_node = source_pin->get_owning_node();
-            const NodeId source_id = source_node->get_id();
+            const NodeId source_id = source.node;
             if (p_context.in_stack.has(source_id)) {
                 errors.push_back({ source_id, vformat("Node %d is part of a data-pin cycle.", source_id) });
                 continue;
@@ -594,13 +595,13 @@ void OScriptFunctionAnalyzer::_collect_data_dependencies(const Ref<OScriptNode>&
 
 void OScriptFunctionAnalyzer::_collect_data_dependencies(const Ref<OScriptNode>& p_node, HashSet<NodeId>& p_dependencies, DataDependencyContext& p_context) {
     for (const Ref<OScriptNodePin>& input : p_node->find_pins(PD_Input)) {
-        if (input.is_valid() && !input->is_execution() && input->has_any_connections()) {
-            const Ref<OScriptNodePin> source_pin = input->get_resolved_connection();
-            if (!source_pin.is_valid()) {
+        OScriptNodePinId source;
+        if (input.is_valid() && !input->is_execution() && p_context.connections->get_resolved_connection(p_node->get_id(), input->get_pin_index(), PD_Input, source)) {
+            const Ref<OScriptNode> source_node = p_context.connections->get_node(source.node);
+            if (!source_node.is_valid()) {
                 continue;
             }
-            const Ref<OScriptNode> source_node = source_pin->get_owning_node();
-            const NodeId source_id = source_node->get_id();
+            const NodeId source_id = source.node;
             if (p_context.in_stack.has(source_id)) {
                 errors.push_back({ source_id, vformat("Node %d is part of a data-pin cycle.", source_id) });
                 continue;
@@ -646,11 +647,9 @@ void OScriptFunctionAnalyzer::_analyze_combined(Context& p_context) {
         if (is_for_loop_node(current)) {
             info.is_loop_node[node_id] = true;
             const Ref<OScriptNodePin> body_pin = current->find_pin("loop_body", PD_Output);
-            if (body_pin.is_valid() && body_pin->has_any_connections()) {
-                const Ref<OScriptNodePin> body_target = body_pin->get_resolved_connection();
-                if (body_target.is_valid()) {
-                    info.loop_body_start_nodes[node_id] = body_target->get_owning_node()->get_id();
-                }
+            OScriptNodePinId body_target;
+            if (body_pin.is_valid() && p_context.connections->get_resolved_connection(node_id, body_pin->get_pin_index(), PD_Output, body_target)) {
+                info.loop_body_start_nodes[node_id] = body_target.node;
             }
         } else if (const Ref<OScriptNodeBranch>& branch = current; branch.is_valid()) {
             info.is_branch_node[node_id] = true;
@@ -659,9 +658,9 @@ void OScriptFunctionAnalyzer::_analyze_combined(Context& p_context) {
         }
 
         for (const Ref<OScriptNodePin>& input : current->find_pins(PD_Input)) {
-            if (input.is_valid() && input->has_any_connections()) {
-                for (const Ref<OScriptNodePin>& source : input->get_resolved_connections()) {
-                    const Ref<OScriptNode> owner = source->get_owning_node();
+            if (input.is_valid()) {
+                for (const OScriptNodePinId& source : p_context.connections->get_resolved_connections(node_id, input->get_pin_index(), PD_Input)) {
+                    const Ref<OScriptNode> owner = p_context.connections->get_node(source.node);
                     if (owner.is_valid()) {
                         visit_types(owner);
                     }
@@ -693,6 +692,7 @@ void OScriptFunctionAnalyzer::_analyze_combined(Context& p_context) {
 
         // --- _analyze_data_dependencies ---
         DataDependencyContext dep_ctx;
+        dep_ctx.connections = p_context.connections;
         _collect_data_dependencies(current, info.node_data_dependencies[node_id], dep_ctx);
         if (info.node_data_dependencies[node_id].size() > 0) {
             info.has_data_dependencies[node_id] = true;
@@ -713,14 +713,14 @@ void OScriptFunctionAnalyzer::_analyze_combined(Context& p_context) {
             info.node_divergence_type[node_id] = OScriptFunctionInfo::DivergenceType::LoopBreak;
             const Ref<OScriptNodePin> abort_pin = current->find_pin("aborted", PD_Output);
             if (abort_pin.is_valid()) {
-                for (const Ref<OScriptNodePin>& target_pin : abort_pin->get_resolved_connections()) {
-                    info.divergence_paths[node_id].insert(target_pin->get_owning_node()->get_id());
+                for (const OScriptNodePinId& target : p_context.connections->get_resolved_connections(node_id, abort_pin->get_pin_index(), PD_Output)) {
+                    info.divergence_paths[node_id].insert(target.node);
                 }
             }
             const Ref<OScriptNodePin> completed_pin = current->find_pin("completed", PD_Output);
             if (completed_pin.is_valid()) {
-                for (const Ref<OScriptNodePin>& target_pin : completed_pin->get_resolved_connections()) {
-                    info.divergence_paths[node_id].insert(target_pin->get_owning_node()->get_id());
+                for (const OScriptNodePinId& target : p_context.connections->get_resolved_connections(node_id, completed_pin->get_pin_index(), PD_Output)) {
+                    info.divergence_paths[node_id].insert(target.node);
                 }
             }
             _find_merge_point(p_context, node_id);
@@ -829,20 +829,24 @@ void OScriptFunctionAnalyzer::_analyze_loop_breaks(Context& p_context) {
             if (break_pin.is_valid()) {
                 info.loop_break_targets.insert({ loop_id, break_pin->get_pin_index() });
 
-                for (const Ref<OScriptNodePin>& input : break_pin->get_resolved_connections()) {
-                    const Ref<OScriptNode> input_node = input->get_owning_node();
-                    if (info.unreachable_nodes.has(input_node->get_id())) {
-                        errors.push_back({ node_id, vformat("Node %d connects to for loop %d break pint but it isn't reachable.", input_node->get_id(), node_id) });
+                for (const OScriptNodePinId& input : p_context.connections->get_resolved_connections(loop_id, break_pin->get_pin_index(), PD_Input)) {
+                    const Ref<OScriptNode> input_node = p_context.connections->get_node(input.node);
+                    if (!input_node.is_valid()) {
+                        continue;
+                    }
+                    if (info.unreachable_nodes.has(input.node)) {
+                        errors.push_back({ node_id, vformat("Node %d connects to for loop %d break pint but it isn't reachable.", input.node, node_id) });
                     } else {
                         if (!info.loop_break_variables.has(loop_id)) {
                             info.loop_break_variables[loop_id] = vformat("for_loop_%d_break", loop_id);
                         }
 
-                        info.loop_break_sources[loop_id].insert({ input_node->get_id(), input->get_pin_index() });
+                        info.loop_break_sources[loop_id].insert(input);
                         // Walk the break source's data inputs solely to surface data-pin cycles (GH-1559).
                         // The collected deps are discarded: they must not enter loop_break_sources, which the loop-body
                         // validation checks for execution control flow, and a data dependency lives off this chain.
                         DataDependencyContext data_context;
+                        data_context.connections = p_context.connections;
                         OScriptNodePinSet break_data_dependencies;
                         _collect_data_dependencies(input_node, break_data_dependencies, data_context);
                     }
@@ -887,7 +891,7 @@ void OScriptFunctionAnalyzer::_validate(const Context& p_context) {
     }
 }
 
-OScriptFunctionInfo OScriptFunctionAnalyzer::analyze_function(const Ref<OScriptFunction>& p_function) {
+OScriptFunctionInfo OScriptFunctionAnalyzer::analyze_function(const Ref<OScriptFunction>& p_function, const OScriptPinConnections& p_connections) {
     #ifdef FUNCTION_ANALYZER_WARNINGS_ENABLED
     warnings.clear();
     #endif
@@ -895,6 +899,7 @@ OScriptFunctionInfo OScriptFunctionAnalyzer::analyze_function(const Ref<OScriptF
 
     // Setup analysis context
     Context context;
+    context.connections = &p_connections;
     context.function = p_function;
     context.entry_node = p_function->get_owning_node();
     context.info.entry_node_id = context.entry_node->get_id();
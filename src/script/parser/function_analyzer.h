@@ -29,6 +29,7 @@ using namespace godot;
 
 // Forward declarations
 class OScriptNode;
+class OScriptPinConnections;
 
 using NodeId = int;
 using PinId = int;
@@ -172,6 +173,7 @@ public:
 private:
     struct Context {
         uint64_t next_net_id = 1;
+        const OScriptPinConnections* connections = nullptr;
         Ref<OScriptFunction> function;
         Ref<OScriptNode> entry_node;
         OScriptFunctionInfo info;
@@ -200,6 +202,7 @@ private:
     static OScriptNodePinSet _get_all_reachable_pins(Context& p_context, const OScriptNodePinId& p_id);
 
     struct DataDependencyContext {
+        const OScriptPinConnections* connections = nullptr;
         HashSet<NodeId> visited;
         HashSet<NodeId> in_stack;
     };
@@ -213,7 +216,11 @@ private:
     void _validate(const Context& p_context);
 
 public:
-    OScriptFunctionInfo analyze_function(const Ref<OScriptFunction>& p_function);
+    /// Analyzes a function graph.
+    /// @param p_function the function
+    /// @param p_connections the resolved connections of the function's orchestration
+    /// @return the function information
+    OScriptFunctionInfo analyze_function(const Ref<OScriptFunction>& p_function, const OScriptPinConnections& p_connections);
 
     #ifdef FUNCTION_ANALYZER_WARNINGS_ENABLED
     bool has_warnings() const { return !warnings.is_empty(); }
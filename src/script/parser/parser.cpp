@@ -255,7 +255,7 @@ OScriptNetKey* OScriptParser::get_net_from_pin(const Ref<OScriptNodePin>& p_pin)
 
 Ref<OScriptNodePin> OScriptParser::get_target_from_source(const Ref<OScriptNodePin>& p_source) {
     if (p_source.is_valid()) {
-        return p_source->get_resolved_connection();
+        return pin_connections.get_resolved_connection(p_source);
     }
     return {};
 }
@@ -867,11 +867,7 @@ OScriptParser::ExpressionNode* OScriptParser::resolve_input(const Ref<OScriptNod
     ERR_FAIL_COND_V(p_pin.is_null(), create_literal(Variant()));
     ERR_FAIL_COND_V(p_pin->is_execution(), create_literal(Variant()));
 
-    if (!p_pin->has_any_connections()) {
-        return build_literal(p_pin);
-    }
-
-    const Ref<OScriptNodePin> source_pin = p_pin->get_resolved_connection();
+    const Ref<OScriptNodePin> source_pin = pin_connections.get_resolved_connection(p_pin);
     if (!source_pin.is_valid()) {
         return build_literal(p_pin);
     }
@@ -931,11 +927,7 @@ OScriptParser::ExpressionNode* OScriptParser::resolve_input(const Ref<OScriptNod
 StringName OScriptParser::get_term_name(const Ref<OScriptNodePin>& p_pin) {
     ERR_FAIL_COND_V(p_pin.is_null(), "");
 
-    if (!p_pin->has_any_connections()) {
-        return "";
-    }
-
-    const Ref<OScriptNodePin> source_pin = p_pin->get_resolved_connection();
+    const Ref<OScriptNodePin> source_pin = pin_connections.get_resolved_connection(p_pin);
     if (!source_pin.is_valid()) {
         return "";
     }
@@ -967,11 +959,7 @@ OScriptParser::ExpressionNode* OScriptParser::build_expression(const Ref<OScript
     ERR_FAIL_COND_V(p_pin.is_null(), nullptr);
     ERR_FAIL_COND_V(p_pin->is_execution(), nullptr);
 
-    if (!p_pin->has_any_connections()) {
-        return build_literal(p_pin);
-    }
-
-    const Ref<OScriptNodePin> source_pin = p_pin->get_resolved_connection();
+    const Ref<OScriptNodePin> source_pin = pin_connections.get_resolved_connection(p_pin);
     if (!source_pin.is_valid()) {
         return build_literal(p_pin);
     }
@@ -1145,21 +1133,12 @@ OScriptParser::ExpressionNode* OScriptParser::build_get_scene_tree(const Ref<OSc
 }
 
 OScriptParser::ExpressionNode* OScriptParser::build_get_scene_node(const Ref<OScriptNodeSceneNode>& p_node, const Ref<OScriptNodePin>& p_pin) {
-    // todo: see if we can fix this
-    // We need to build this using this approach since validated calls with GetNodeNode are not
-    // currently supported by GDExtension due to how parameter binding works :(
-    CallNode* construct_node_path = create_func_call("NodePath");
-    construct_node_path->arguments.push_back(create_literal(p_node->get_scene_node_path()));
-
-    CallNode* get_node = create_func_call("get_node");
-    get_node->arguments.push_back(construct_node_path);
-
+    // The compiler interns the path as a constant and the instance caches the resolved node, so
+    // repeated evaluations do not construct a NodePath nor walk the scene tree.
+    GetNodeNode* get_node = alloc_node<GetNodeNode>();
+    get_node->full_path = String(p_node->get_scene_node_path());
+    get_node->use_dollar = false;
     return get_node;
-
-    // GetNodeNode* get_node = alloc_node<GetNodeNode>();
-    // get_node->full_path = p_node->get_scene_node_path();
-    // get_node->use_dollar = false;
-    // return get_node;
 }
 
 OScriptParser::ExpressionNode* OScriptParser::build_get_singleton(const Ref<OScriptNodeEngineSingleton>& p_node, const Ref<OScriptNodePin>& p_pin) {
@@ -1390,7 +1369,7 @@ OScriptParser::ExpressionNode* OScriptParser::build_deconstruct(const Ref<OScrip
     // Short-circuit attempt to reduce and do a direct pass of values if there is a compose followed by decompose
     const Ref<OScriptNodePin> input_pin = p_node->find_pin(0, PD_Input);
     if (input_pin.is_valid() && input_pin->has_any_connections()) {
-        const Ref<OScriptNodePin> resolved = input_pin->get_resolved_connection();
+        const Ref<OScriptNodePin> resolved = pin_connections.get_resolved_connection(input_pin);
         const Ref<OScriptNode> source_node = resolved.is_valid() ? resolved->get_owning_node() : Ref<OScriptNode>();
 
         bool reduce = false;
@@ -2151,7 +2130,7 @@ OScriptParser::StatementResult OScriptParser::build_call_super(const Ref<OScript
 OScriptParser::StatementResult OScriptParser::build_sequence(const Ref<OScriptNodeSequence>& p_script_node) {
     for (const Ref<OScriptNodePin>& output : p_script_node->find_pins(PD_Output)) {
         if (output.is_valid() && output->has_any_connections()) {
-            const Ref<OScriptNodePin> start_node_pin = output->get_resolved_connection();
+            const Ref<OScriptNodePin> start_node_pin = pin_connections.get_resolved_connection(output);
             // Given that a SequenceNode does not introduce any special scope, we append
             // all statements to the current suite.
             if (start_node_pin.is_valid()) {
@@ -2418,18 +2397,11 @@ OScriptParser::StatementResult OScriptParser::build_chance(const Ref<OScriptNode
 }
 
 OScriptParser::StatementResult OScriptParser::build_delay(const Ref<OScriptNodeDelay>& p_script_node) {
-    // Using get_tree() here can result in null problems when the node may not be inside the tree yet.
-    // By relying on Engine, we get access to the SceneTree object to create the timer always.
-    // Engine.get_main_loop().create_timer(<duration>)
-    CallNode* call_create_timer = create_func_call(create_func_call(build_identifier("Engine"), "get_main_loop"), "create_timer");
-    call_create_timer->arguments.push_back(create_literal(p_script_node->get_duration()));
-
-    // Get the timeout signal from the base
-    SubscriptNode* timeout = create_subscript_attribute(call_create_timer, build_identifier("timeout"));
-
-    // Await on the signal
+    // Delays are resumed by the language's scheduler, which avoids allocating a SceneTreeTimer and
+    // connecting a signal for each delay, and does not depend on the node being inside the tree.
     AwaitNode* await_node = alloc_node<AwaitNode>();
-    await_node->to_await = timeout;
+    await_node->to_await = create_literal(p_script_node->get_duration());
+    await_node->is_delay = true;
 
     set_coroutine();
     add_statement(await_node);
@@ -2825,9 +2797,19 @@ OScriptParser::StatementResult OScriptParser::build_instantiate_scene(const Ref<
     const Ref<OScriptNodePin> scene_pin = p_script_node->find_pin(1, PD_Output);
     const String scene_term = create_cached_variable_name(scene_pin);
 
-    // todo: consider having the node operate via toggle to always create a new instance when traversed.
+    const Ref<OScriptNodePin> path_pin = p_script_node->find_pin(1, PD_Input);
+
     CallNode* call_node = create_func_call("_oscript_internal_instantiate_scene");
-    call_node->arguments.push_back(resolve_input(p_script_node->find_pin(1, PD_Input)));
+    call_node->arguments.push_back(resolve_input(path_pin));
+
+    // A constant scene path is not loaded here, as a scene whose script instantiates its own scene would
+    // then load cyclically. Instead, the scene is loaded on first traversal and cached by the call site.
+    const bool constant_path = path_pin.is_valid() && !path_pin->has_any_connections();
+    if (constant_path || p_script_node->get_pool_size() > 0) {
+        // Caches and pools are scoped to the script node
+        call_node->arguments.push_back(create_literal(p_script_node->get_pool_size()));
+        call_node->arguments.push_back(create_literal(StringName(vformat("%s:%d", script_path, p_script_node->get_id()))));
+    }
 
     create_local_and_push(scene_term, call_node);
     add_pin_alias(scene_term, scene_pin);
@@ -2993,7 +2975,7 @@ OScriptParser::StatementResult OScriptParser::build_free_object(const Ref<OScrip
     const Ref<OScriptNodePin> object_pin = p_script_node->find_pin(1, PD_Input);
 
     if (object_pin->has_any_connections()) {
-        const Ref<OScriptNodePin> _src_pin = object_pin->get_resolved_connection();
+        const Ref<OScriptNodePin> _src_pin = pin_connections.get_resolved_connection(object_pin);
         const StringName class_name = _src_pin.is_valid() ? _src_pin->get_property_info().class_name : StringName();
 
         bool is_node = false;
@@ -3137,7 +3119,7 @@ OScriptParser::VariableNode* OScriptParser::build_variable(const Ref<OScriptVari
     variable->datatype_specifier = build_type(p_variable->get_info());
 
     if (p_variable->is_exported()) {
-        AnnotationNode* annotation = memnew(AnnotationNode);
+        AnnotationNode* annotation = alloc_node<AnnotationNode>();
         annotation->name = "@export";
         annotation->info = &valid_annotations[annotation->name];
 
@@ -3229,7 +3211,7 @@ OScriptParser::FunctionNode* OScriptParser::build_function(const Ref<OScriptFunc
 
     // Perform function graph pre-pass analysis
     OScriptFunctionAnalyzer analyzer;
-    function_info = analyzer.analyze_function(p_function);
+    function_info = analyzer.analyze_function(p_function, pin_connections);
     if (analyzer.has_errors()) {
         for (const OScriptFunctionAnalyzer::AnalyzerError& error : analyzer.get_errors()) {
             push_error(error.message, error.node);
@@ -3350,7 +3332,7 @@ OScriptParser::SuiteNode* OScriptParser::build_suite(const String& p_name, const
     }
 
     if (p_source_pin.is_valid() && p_source_pin->has_any_connections()) {
-        const Ref<OScriptNodePin> target_pin = p_source_pin->get_resolved_connection();
+        const Ref<OScriptNodePin> target_pin = pin_connections.get_resolved_connection(p_source_pin);
         if (target_pin.is_valid()) {
             // Build statements for the suite
             build_statements(p_source_pin, target_pin, suite);
@@ -3713,7 +3695,11 @@ Error OScriptParser::parse(Orchestration* p_orchestration, const String& p_scrip
     ERR_FAIL_NULL_V_MSG(p_orchestration, ERR_PARSE_ERROR, "Orchestration was null and cannot be parsed.");
 
     script_path = p_script_path;
+
+    // Resolve connections once, the view is only valid while the orchestration is unchanged
+    pin_connections.build(p_orchestration);
     build_class(p_orchestration);
+    pin_connections.clear();
 
     return errors.is_empty() ? OK : ERR_PARSE_ERROR;
 }
@@ -3837,11 +3823,7 @@ OScriptParser::OScriptParser() {
 }
 
 OScriptParser::~OScriptParser() {
-    while (node_list_head != nullptr) {
-        Node *element = node_list_head;
-        node_list_head = node_list_head->next;
-        memdelete(element);
-    }
+    node_arena.release();
 }
 
 
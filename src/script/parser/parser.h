@@ -17,8 +17,10 @@
 #pragma once
 
 #include "orchestration/nodes.h"
+#include "script/parser/parser_arena.h"
 #include "script/parser/parser_nodes.h"
 #include "script/parser/function_analyzer.h"
+#include "script/parser/pin_connections.h"
 #include "script/script_cache.h"
 #include "script/script_source.h"
 #include "script/script_warning.h"
@@ -103,6 +105,7 @@ private:
     LambdaNode* current_lambda = nullptr;
     FunctionNode* current_function = nullptr;
     OScriptFunctionInfo function_info;
+    OScriptPinConnections pin_connections;
 
     bool in_lambda = false;
     bool lambda_ended = false; // Mark for when a lambda ends, to apply an end of statement as needed
@@ -135,14 +138,12 @@ private:
         }
     };
 
-    Node* node_list_head = nullptr;
+    OScriptParserArena node_arena;
 
     template <typename T>
     T* alloc_node() {
-        T* node = memnew(T);
+        T* node = node_arena.alloc<T>();
         node->script_node_id = _current_node_id;
-        node->next = node_list_head;
-        node_list_head = node;
         return node;
     }
 
@@ -0,0 +1,53 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/parser/parser_arena.h"
+
+void* OScriptParserArena::_allocate(size_t p_size, size_t p_alignment) {
+    if (_block) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(_block->data());
+        const uintptr_t address = (base + _block->used + p_alignment - 1) & ~static_cast<uintptr_t>(p_alignment - 1);
+        if (address + p_size <= base + _block->capacity) {
+            _block->used = address + p_size - base;
+            return reinterpret_cast<void*>(address);
+        }
+    }
+
+    // Oversized nodes get a dedicated block, the slack covers alignment of the block's data.
+    const size_t capacity = MAX(BLOCK_SIZE, p_size + p_alignment);
+
+    Block* block = static_cast<Block*>(memalloc(sizeof(Block) + capacity));
+    block->previous = _block;
+    block->capacity = capacity;
+    block->used = 0;
+    _block = block;
+
+    return _allocate(p_size, p_alignment);
+}
+
+void OScriptParserArena::release() {
+    while (_nodes != nullptr) {
+        OScriptParserNodes::Node* node = _nodes;
+        _nodes = node->next;
+        node->~Node();
+    }
+
+    while (_block != nullptr) {
+        Block* previous = _block->previous;
+        memfree(_block);
+        _block = previous;
+    }
+}
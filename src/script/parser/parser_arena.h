@@ -0,0 +1,60 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include "script/parser/parser_nodes.h"
+
+#include <godot_cpp/core/memory.hpp>
+
+using namespace godot;
+
+/// Bump allocator for parser AST nodes.
+///
+/// Nodes are placed back-to-back in large blocks rather than allocated individually, and all blocks
+/// are released together once the tree is discarded. Allocated nodes are still threaded through
+/// <code>Node::next</code> so their destructors run on release.
+///
+/// The arena only holds raw pointers and is copied like one, ownership follows the parser that calls
+/// <code>release</code>, matching how <code>OScriptParser::clear</code> hands its tree to a temporary.
+class OScriptParserArena {
+    static constexpr size_t BLOCK_SIZE = 32 * 1024;
+
+    struct Block {
+        Block* previous = nullptr;
+        size_t capacity = 0;
+        size_t used = 0;
+
+        _FORCE_INLINE_ uint8_t* data() { return reinterpret_cast<uint8_t*>(this + 1); }
+    };
+
+    Block* _block = nullptr;
+    OScriptParserNodes::Node* _nodes = nullptr;
+
+    void* _allocate(size_t p_size, size_t p_alignment);
+
+public:
+    template <typename T>
+    T* alloc() {
+        T* node = memnew_placement(_allocate(sizeof(T), alignof(T)), T);
+        node->next = _nodes;
+        _nodes = node;
+        return node;
+    }
+
+    /// Destroys all allocated nodes and frees the blocks that held them.
+    void release();
+};
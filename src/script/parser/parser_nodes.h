@@ -339,6 +339,9 @@ namespace OScriptParserNodes
 
     struct AwaitNode : ExpressionNode {
         ExpressionNode* to_await = nullptr;
+        // When set, to_await is a duration in seconds and the coroutine resumes from the language's
+        // delay scheduler rather than from a signal.
+        bool is_delay = false;
 
         AwaitNode() { type = AWAIT; }
     };
@@ -170,7 +170,7 @@ void OScriptParserUtils::Printer::print_assignment(AssignmentNode* p_assignment)
 }
 
 void OScriptParserUtils::Printer::print_await(AwaitNode* p_await) {
-	push_text("Await ");
+	push_text(p_await->is_delay ? "Await Delay " : "Await ");
 	print_expression(p_await->to_await);
 }
 
@@ -1474,6 +1474,7 @@ void OScriptParserUtils::Writer::write_await(AwaitNode* p_await) {
 
     StringBuilder::IndentScope indent(buffer);
     write_node(p_await);
+    write_yesno("Delay", p_await->is_delay, false);
     push_line("ToAwait");
     write_expression(p_await->to_await);
 }
@@ -0,0 +1,167 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "script/parser/pin_connections.h"
+
+#include "orchestration/orchestration.h"
+
+uint64_t OScriptPinConnections::_key(NodeId p_node, PinId p_pin) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(p_node)) << 32) | static_cast<uint32_t>(p_pin);
+}
+
+const OScriptPinConnections::Entry* OScriptPinConnections::_get_entry(NodeId p_node, PinId p_pin, EPinDirection p_direction) const {
+    return (p_direction == PD_Input ? _inputs : _outputs).getptr(_key(p_node, p_pin));
+}
+
+void OScriptPinConnections::build(const Orchestration* p_orchestration) {
+    clear();
+
+    ERR_FAIL_NULL(p_orchestration);
+
+    for (const Ref<OScriptNode>& node : p_orchestration->get_nodes()) {
+        _nodes[node->get_id()] = node.ptr();
+    }
+
+    // Direct connections by pin, in connection order, skipping hidden pins and missing endpoints
+    // just as Orchestration::get_connections does.
+    HashMap<uint64_t, LocalVector<OScriptNodePinId>> inputs;
+    HashMap<uint64_t, LocalVector<OScriptNodePinId>> outputs;
+    for (const OScriptConnection& E : p_orchestration->get_connections()) {
+        OScriptNode* const* source = _nodes.getptr(E.from_node);
+        OScriptNode* const* target = _nodes.getptr(E.to_node);
+        if (!source || !target) {
+            continue;
+        }
+
+        const Ref<OScriptNodePin> source_pin = (*source)->find_pin(E.from_port, PD_Output);
+        const Ref<OScriptNodePin> target_pin = (*target)->find_pin(E.to_port, PD_Input);
+        if (source_pin.is_null() || target_pin.is_null()) {
+            continue;
+        }
+
+        const OScriptNodePinId source_id = { static_cast<NodeId>(E.from_node), static_cast<PinId>(E.from_port) };
+        const OScriptNodePinId target_id = { static_cast<NodeId>(E.to_node), static_cast<PinId>(E.to_port) };
+
+        if (!target_pin->is_hidden()) {
+            inputs[_key(target_id.node, target_id.pin)].push_back(source_id);
+        }
+        if (!source_pin->is_hidden()) {
+            outputs[_key(source_id.node, source_id.pin)].push_back(target_id);
+        }
+    }
+
+    // Follows a reroute chain the way OScriptNodePin::_resolve_reroute does, taking the first
+    // connection on the far side of each reroute. Reroute cycles resolve to nothing.
+    const auto resolve = [&](OScriptNodePinId p_id, EPinDirection p_direction, OScriptNodePinId& r_id) -> bool {
+        const EPinDirection other = p_direction == PD_Input ? PD_Output : PD_Input;
+        const HashMap<uint64_t, LocalVector<OScriptNodePinId>>& far_side = other == PD_Input ? inputs : outputs;
+
+        for (uint32_t hops = 0; hops <= _nodes.size(); hops++) {
+            OScriptNode* node = _nodes[p_id.node];
+            if (!node->is_reroute()) {
+                r_id = p_id;
+                return true;
+            }
+
+            const Ref<OScriptNodePin> other_pin = node->find_pin(other == PD_Input ? "input" : "output", other);
+            if (other_pin.is_null()) {
+                return false;
+            }
+
+            const LocalVector<OScriptNodePinId>* next = far_side.getptr(_key(p_id.node, other_pin->get_pin_index()));
+            if (!next || next->is_empty()) {
+                return false;
+            }
+
+            p_id = (*next)[0];
+        }
+        return false;
+    };
+
+    for (const KeyValue<uint64_t, LocalVector<OScriptNodePinId>>& E : inputs) {
+        Entry& entry = _inputs[E.key];
+        entry.connected = E.value.size();
+        for (const OScriptNodePinId& id : E.value) {
+            OScriptNodePinId resolved;
+            if (resolve(id, PD_Output, resolved)) {
+                entry.resolved.push_back(resolved);
+            }
+        }
+    }
+
+    for (const KeyValue<uint64_t, LocalVector<OScriptNodePinId>>& E : outputs) {
+        Entry& entry = _outputs[E.key];
+        entry.connected = E.value.size();
+        for (const OScriptNodePinId& id : E.value) {
+            OScriptNodePinId resolved;
+            if (resolve(id, PD_Input, resolved)) {
+                entry.resolved.push_back(resolved);
+            }
+        }
+    }
+}
+
+void OScriptPinConnections::clear() {
+    _nodes.clear();
+    _inputs.clear();
+    _outputs.clear();
+}
+
+Ref<OScriptNode> OScriptPinConnections::get_node(NodeId p_node) const {
+    OScriptNode* const* node = _nodes.getptr(p_node);
+    return node ? Ref<OScriptNode>(*node) : Ref<OScriptNode>();
+}
+
+Ref<OScriptNodePin> OScriptPinConnections::get_pin(const OScriptNodePinId& p_id, EPinDirection p_direction) const {
+    OScriptNode* const* node = _nodes.getptr(p_id.node);
+    return node ? (*node)->find_pin(p_id.pin, p_direction) : Ref<OScriptNodePin>();
+}
+
+OScriptPinConnections::Span OScriptPinConnections::get_resolved_connections(NodeId p_node, PinId p_pin, EPinDirection p_direction) const {
+    const Entry* entry = _get_entry(p_node, p_pin, p_direction);
+    if (!entry) {
+        return {};
+    }
+
+    Span span;
+    span.ptr = entry->resolved.ptr();
+    span.count = entry->resolved.size();
+    return span;
+}
+
+bool OScriptPinConnections::get_resolved_connection(NodeId p_node, PinId p_pin, EPinDirection p_direction, OScriptNodePinId& r_id) const {
+    // Matches get_single_connection, more than one direct connection yields no result
+    const Entry* entry = _get_entry(p_node, p_pin, p_direction);
+    if (!entry || entry->connected != 1 || entry->resolved.is_empty()) {
+        return false;
+    }
+
+    r_id = entry->resolved[0];
+    return true;
+}
+
+Ref<OScriptNodePin> OScriptPinConnections::get_resolved_connection(const Ref<OScriptNodePin>& p_pin) const {
+    if (p_pin.is_null() || !p_pin->get_owning_node()) {
+        return {};
+    }
+
+    OScriptNodePinId id;
+    if (!get_resolved_connection(p_pin->get_owning_node()->get_id(), p_pin->get_pin_index(), p_pin->get_direction(), id)) {
+        return {};
+    }
+
+    return get_pin(id, p_pin->is_input() ? PD_Output : PD_Input);
+}
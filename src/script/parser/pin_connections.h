@@ -0,0 +1,106 @@
+// This file is part of the Godot Orchestrator project.
+//
+// Copyright (c) 2023-present Crater Crash Studios LLC and its contributors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include "script/parser/function_analyzer.h"
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+using namespace godot;
+
+// Forward declarations
+class Orchestration;
+
+/// A read-only view of an orchestration's pin connections, with reroute chains already resolved.
+///
+/// The view is built once per parse and answers connection queries with node id and pin index
+/// handles, so the parser and the function analyzer can walk the graph without building pin
+/// vectors or following reroute nodes on every query. Resolution matches
+/// <code>OScriptNodePin::get_resolved_connections</code>.
+///
+/// The view holds raw node pointers and must not outlive the orchestration it was built from, nor
+/// be used after the orchestration's nodes or connections change.
+class OScriptPinConnections {
+public:
+    /// A read-only run of resolved pin handles, in connection order.
+    struct Span {
+        const OScriptNodePinId* ptr = nullptr;
+        uint32_t count = 0;
+
+        bool is_empty() const { return count == 0; }
+        uint32_t size() const { return count; }
+        const OScriptNodePinId& operator[](uint32_t p_index) const { return ptr[p_index]; }
+
+        const OScriptNodePinId* begin() const { return ptr; }
+        const OScriptNodePinId* end() const { return ptr + count; }
+    };
+
+private:
+    struct Entry {
+        LocalVector<OScriptNodePinId> resolved;  //! Resolved endpoints, reroutes removed
+        uint32_t connected = 0;                  //! Number of direct connections with a valid endpoint
+    };
+
+    HashMap<NodeId, OScriptNode*> _nodes;
+    HashMap<uint64_t, Entry> _inputs;
+    HashMap<uint64_t, Entry> _outputs;
+
+    static uint64_t _key(NodeId p_node, PinId p_pin);
+
+    const Entry* _get_entry(NodeId p_node, PinId p_pin, EPinDirection p_direction) const;
+
+public:
+    /// Builds the view from the orchestration's current nodes and connections.
+    /// @param p_orchestration the orchestration
+    void build(const Orchestration* p_orchestration);
+
+    /// Releases the view.
+    void clear();
+
+    /// Get a node by its id.
+    /// @param p_node the node id
+    /// @return the node, or an invalid reference if the node does not exist
+    Ref<OScriptNode> get_node(NodeId p_node) const;
+
+    /// Get a pin by its handle.
+    /// @param p_id the pin handle
+    /// @param p_direction the pin direction
+    /// @return the pin, or an invalid reference if the pin does not exist
+    Ref<OScriptNodePin> get_pin(const OScriptNodePinId& p_id, EPinDirection p_direction) const;
+
+    /// Returns the resolved endpoints of a pin, equivalent to <code>get_resolved_connections</code>.
+    /// @param p_node the node id
+    /// @param p_pin the pin index
+    /// @param p_direction the pin direction
+    /// @return the endpoints, valid until the view is rebuilt or cleared
+    Span get_resolved_connections(NodeId p_node, PinId p_pin, EPinDirection p_direction) const;
+
+    /// Returns the resolved endpoint of a pin with a single connection, equivalent to
+    /// <code>get_resolved_connection</code>.
+    /// @param p_node the node id
+    /// @param p_pin the pin index
+    /// @param p_direction the pin direction
+    /// @param r_id the endpoint, when found
+    /// @return true if the pin has exactly one connection and it resolves to a pin
+    bool get_resolved_connection(NodeId p_node, PinId p_pin, EPinDirection p_direction, OScriptNodePinId& r_id) const;
+
+    /// Returns the resolved endpoint pin of a pin with a single connection.
+    /// @param p_pin the pin
+    /// @return the endpoint pin, or an invalid reference
+    Ref<OScriptNodePin> get_resolved_connection(const Ref<OScriptNodePin>& p_pin) const;
+};
@@ -23,6 +23,7 @@
 #include "orchestration/nodes.h"
 #include "orchestration/serialization/text/text_parser.h"
 #include "script/compiler/analyzer.h"
+#include "script/compiler/bytecode_image.h"
 #include "script/compiler/compiler.h"
 #include "script/language.h"
 #include "script/parser/parser.h"
@@ -182,6 +183,17 @@ void OScript::_static_default_init() {
     }
 }
 
+void OScript::_update_member_indices_snapshot() {
+    #ifdef DEBUG_ENABLED
+    // Always a new dictionary, as instances created from the previous compilation still refer to the old one
+    Dictionary snapshot;
+    for (const KeyValue<StringName, MemberInfo>& E : member_indices) {
+        snapshot[E.key] = E.value.index;
+    }
+    member_indices_snapshot = snapshot;
+    #endif
+}
+
 Variant OScript::callp(const StringName& p_method, const Variant** p_args, int p_arg_count, GDExtensionCallError& r_error) {
     OScript* top = this;
     while (top) {
@@ -229,7 +241,10 @@ void OScript::_super_implicit_constructor(OScript* p_script, OScriptInstance* p_
 
     ERR_FAIL_NULL(p_script->implicit_initializer);
     if (likely(p_script->_valid)) {
-        p_script->implicit_initializer->call(p_instance, nullptr, 0, r_error);
+        // When every member is set from the default member image, there is no code to run
+        if (p_script->has_implicit_initialization) {
+            p_script->implicit_initializer->call(p_instance, nullptr, 0, r_error);
+        }
     } else {
         r_error.error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
     }
@@ -237,16 +252,14 @@ void OScript::_super_implicit_constructor(OScript* p_script, OScriptInstance* p_
 
 OScriptInstance* OScript::_create_instance(const Variant** p_args, int p_arg_count, Object* p_owner, GDExtensionCallError& r_error) const {
     OScriptInstance* si = memnew(OScriptInstance(Ref<OScript>(this), p_owner));
-    si->_members.resize(member_indices.size());
+    si->_members = member_default_image;
     si->_script = Ref<OScript>(this);
     si->_owner = p_owner;
     si->_owner_id = p_owner->get_instance_id();
 
     #ifdef DEBUG_ENABLED
     // Needed for hot reloading
-    for (const KeyValue<StringName, MemberInfo>& E : member_indices) {
-        si->_member_indices_cache[E.key] = E.value.index;
-    }
+    si->_member_indices_cache = member_indices_snapshot;
     #endif
 
     si->set_instance_info(GDEXTENSION_SCRIPT_INSTANCE_CREATE(&OScriptInstance::INSTANCE_INFO, si));
@@ -779,6 +792,22 @@ Error OScript::_reload(bool p_keep_state) {
 
     _valid = false;
 
+    // Exported projects may ship a precompiled bytecode image with the script, which is loaded in place
+    // of building and compiling the orchestration. Any mismatch falls back to compiling from source.
+    if (orchestration.is_null() && OScriptBytecodeImage::load(this) == OK) {
+        can_run = ScriptServer::is_scripting_enabled() || _is_tool();
+        if (can_run) {
+            Error err = _static_init();
+            if (err) {
+                reloading = false;
+                return err;
+            }
+        }
+
+        reloading = false;
+        return OK;
+    }
+
     const int64_t modified_time = FileAccess::get_modified_time(path);
     switch (source.get_type()) {
         case OScriptSource::BINARY: {
@@ -1261,6 +1290,9 @@ void OScript::clear() {
     }
 
     for (const KeyValue<StringName, OScriptCompiledFunction*>& E : member_functions) {
+        for (int i = 0; i < E.value->oscript_functions_count; i++) {
+            E.value->oscript_functions_ptr[i] = nullptr;
+        }
         functions_to_clear.insert(E.value);
     }
     member_functions.clear();
@@ -1270,6 +1302,7 @@ void OScript::clear() {
     }
 
     member_indices.clear();
+    member_default_image.clear();
     static_variables.clear();
     static_variables_indices.clear();
 
@@ -1302,7 +1335,7 @@ void OScript::clear() {
 }
 
 void OScript::cancel_pending_functions(bool p_warn) {
-    MutexLock lock(*OScriptLanguage::get_singleton()->lock.ptr());
+    MutexLock lock(*OScriptLanguage::get_singleton()->func_state_lock.ptr());
     while (SelfList<OScriptFunctionState>* E = pending_func_states.first()) {
         // Order matters since clearing the stack may already cause the OScriptFunctionState
         // to be destroyed and thus removed from the list.
@@ -1554,6 +1587,16 @@ String OScript::dump_compiled_state() {
             result += "\n\n";
 
             #ifdef DEBUG_ENABLED
+            if (E.value->is_optimized()) {
+                Vector<String> unoptimized_lines;
+                result += vformat("Disassembly (before optimization, code size %d):\n-----------------------------------------------------\n", E.value->unoptimized_code.size());
+                E.value->disassemble(Vector<String>(), unoptimized_lines, true);
+                for (const String& line : unoptimized_lines) {
+                    result += vformat("%s\n", line);
+                }
+                result += "\n";
+            }
+
             Vector<String> lines;
             result += vformat("Disassembly:\n-----------------------------------------------------\n");
             E.value->disassemble(Vector<String>(), lines);
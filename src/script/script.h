@@ -46,6 +46,7 @@ class OScript : public ScriptExtension {
     GDCLASS(OScript, ScriptExtension);
 
     friend class OScriptAnalyzer;
+    friend class OScriptBytecodeImage;
     friend class OScriptCompiledFunction;
     friend class OScriptCompiler;
     friend class OScriptDocGen;
@@ -91,6 +92,13 @@ class OScript : public ScriptExtension {
     HashMap<StringName, MemberInfo> member_indices;
     HashSet<StringName> members;
 
+    // Initial member values of an instance, including inherited members. Members with a constant,
+    // value-typed initializer are set here instead of by `@implicit_new()`.
+    Vector<Variant> member_default_image;
+    #ifdef DEBUG_ENABLED
+    Dictionary member_indices_snapshot; // Member name to index, shared with instances for hot reloading
+    #endif
+
     HashMap<StringName, MemberInfo> static_variables_indices;
     Vector<Variant> static_variables;
 
@@ -153,6 +161,7 @@ class OScript : public ScriptExtension {
 
     OScriptCompiledFunction* initializer = nullptr; // Direct pointer to `new()` / `_init()`.
     OScriptCompiledFunction* implicit_initializer = nullptr; // `@implicit_new()` special function.
+    bool has_implicit_initialization = false; // Whether `@implicit_new()` has code beyond the default member image.
     OScriptCompiledFunction* implicit_ready = nullptr; // `@implicit_ready()` special function.
     OScriptCompiledFunction* static_initializer = nullptr; // `@static_initializer()` special function
 
@@ -179,6 +188,7 @@ class OScript : public ScriptExtension {
 
     Error _static_init();
     void _static_default_init(); // Initialize static variables with default values based on types.
+    void _update_member_indices_snapshot();
 
     Variant callp(const StringName& p_method, const Variant** p_args, int p_arg_count, GDExtensionCallError& r_error);
 
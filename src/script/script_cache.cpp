@@ -21,6 +21,7 @@
 #include "orchestration/serialization/binary/binary_parser.h"
 #include "orchestration/serialization/text/text_parser.h"
 #include "script/compiler/analyzer.h"
+#include "script/compiler/bytecode_image.h"
 #include "script/compiler/compiler.h"
 #include "script/parser/parser.h"
 #include "script/serialization/format_defs.h"
@@ -336,9 +337,12 @@ Ref<OScript> OScriptCache::get_shallow_script(const String& p_path, Error& r_err
         return {}; // Returns null and does not cache when the script fails to load.
     }
 
-    Ref<OScriptParserRef> parser_ref = get_parser(p_path, OScriptParserRef::PARSED, r_error);
-    if (r_error == OK) {
-        OScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
+    // A precompiled bytecode image describes the inner classes, avoiding a parse of the orchestration.
+    if (!OScriptBytecodeImage::make_scripts(script.ptr())) {
+        Ref<OScriptParserRef> parser_ref = get_parser(p_path, OScriptParserRef::PARSED, r_error);
+        if (r_error == OK) {
+            OScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
+        }
     }
 
     _singleton->_shallow_cache[p_path] = script;
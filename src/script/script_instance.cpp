@@ -16,6 +16,7 @@
 //
 #include "script/script_instance.h"
 
+#include "common/callable_lambda.h"
 #include "common/dictionary_utils.h"
 #include "core/godot/core_string_names.h"
 #include "core/godot/gdextension_compat.h"
@@ -844,6 +845,11 @@ int OScriptInstance::get_method_argument_count(const StringName& p_name, bool* r
 }
 
 void OScriptInstance::notification(int p_notification, bool p_reversed) {
+    // Cached scene nodes are resolved relative to the owner's position in the tree.
+    if (p_notification == Node::NOTIFICATION_EXIT_TREE) {
+        clear_scene_node_cache();
+    }
+
     if (unlikely(!_script->_valid)) {
         return;
     }
@@ -932,7 +938,95 @@ Variant OScriptInstance::callp(const StringName& p_method, const Variant** p_arg
     // // return {};
 }
 
+void OScriptInstance::_clear_scene_node_cache_entry(SceneNodeCacheEntry& r_entry) {
+    if (Node* node = Object::cast_to<Node>(ObjectDB::get_instance(r_entry.node_id))) {
+        if (node->is_connected(SceneStringName(tree_exited), r_entry.invalidate)) {
+            node->disconnect(SceneStringName(tree_exited), r_entry.invalidate);
+        }
+        if (node->is_connected(SceneStringName(renamed), r_entry.invalidate)) {
+            node->disconnect(SceneStringName(renamed), r_entry.invalidate);
+        }
+    }
+    r_entry = SceneNodeCacheEntry();
+}
+
+void OScriptInstance::_invalidate_scene_node(const OScript* p_script, uint32_t p_slot) {
+    for (SceneNodeCache& cache : _scene_node_caches) {
+        if (cache.script == p_script) {
+            if (p_slot < cache.entries.size()) {
+                _clear_scene_node_cache_entry(cache.entries[p_slot]);
+            }
+            return;
+        }
+    }
+}
+
+Node* OScriptInstance::resolve_scene_node(const OScript* p_script, int p_slot, const NodePath& p_path) {
+    Node* owner = Object::cast_to<Node>(_owner);
+    ERR_FAIL_NULL_V_MSG(owner, nullptr, "Scene nodes can only be resolved from node instances.");
+
+    Node* node = owner->get_node<Node>(p_path);
+
+    // Only nodes resolved inside the tree are cached, as the tree notifications are what keep the
+    // cache coherent. Outside the tree, every evaluation resolves the path.
+    if (!node || !owner->is_inside_tree() || !node->is_inside_tree()) {
+        return node;
+    }
+
+    // Only the target's signals are watched, so a path through other nodes, which could be renamed
+    // or moved without the target noticing, is resolved on every evaluation.
+    if (p_path.is_absolute() || p_path.get_name_count() != 1) {
+        return node;
+    }
+
+    SceneNodeCache* cache = nullptr;
+    for (SceneNodeCache& E : _scene_node_caches) {
+        if (E.script == p_script) {
+            cache = &E;
+            break;
+        }
+    }
+
+    if (!cache) {
+        _scene_node_caches.push_back(SceneNodeCache());
+        cache = &_scene_node_caches[_scene_node_caches.size() - 1];
+        cache->script = p_script;
+    }
+
+    if ((uint32_t)p_slot >= cache->entries.size()) {
+        cache->entries.resize(p_slot + 1);
+    }
+
+    SceneNodeCacheEntry& entry = cache->entries[p_slot];
+    _clear_scene_node_cache_entry(entry);
+
+    entry.node = node;
+    entry.node_id = node->get_instance_id();
+    entry.invalidate = callable_mp_lambda(_owner, [this, p_script, p_slot] {
+        _invalidate_scene_node(p_script, p_slot);
+    });
+
+    node->connect(SceneStringName(tree_exited), entry.invalidate);
+    node->connect(SceneStringName(renamed), entry.invalidate);
+
+    return node;
+}
+
+void OScriptInstance::clear_scene_node_cache() {
+    for (SceneNodeCache& cache : _scene_node_caches) {
+        for (SceneNodeCacheEntry& entry : cache.entries) {
+            if (entry.node) {
+                _clear_scene_node_cache_entry(entry);
+            }
+        }
+    }
+    _scene_node_caches.clear();
+}
+
 void OScriptInstance::reload_members() {
+    // Recompiled scripts may assign different slots to the same paths
+    clear_scene_node_cache();
+
     #ifdef DEBUG_ENABLED
     Vector<Variant> new_members;
     new_members.resize(_script->member_indices.size());
@@ -940,8 +1034,8 @@ void OScriptInstance::reload_members() {
     // Pass values to the new indices
     for (KeyValue<StringName, OScript::MemberInfo>& E : _script->member_indices) {
         if (_member_indices_cache.has(E.key)) {
-            Variant value = _members[_member_indices_cache[E.key]];
-            new_members.write[E.value.index] = value;
+            const int old_index = _member_indices_cache[E.key];
+            new_members.write[E.value.index] = _members[old_index];
         }
     }
 
@@ -949,10 +1043,7 @@ void OScriptInstance::reload_members() {
     _members = new_members;
 
     // Pass values to new indices
-    _member_indices_cache.clear();
-    for (const KeyValue<StringName, OScript::MemberInfo>& E : _script->member_indices) {
-        _member_indices_cache[E.key] = E.value.index;
-    }
+    _member_indices_cache = _script->member_indices_snapshot;
     #endif
 }
 
@@ -961,21 +1052,26 @@ OScriptInstance::OScriptInstance(const Ref<OScript>& p_script, Object* p_owner)
 }
 
 OScriptInstance::~OScriptInstance() {
-    MutexLock lock(*OScriptLanguage::get_singleton()->lock.ptr());
-    while (SelfList<OScriptFunctionState>* E = _pending_func_states.first()) {
-        // Order matters since clearing the stack may already cause the OScriptFunctionState to
-        // be destroyed and thus removed from the list.
-        _pending_func_states.remove(E);
-
-        OScriptFunctionState* state = E->self();
-        ObjectID state_id = ObjectID(state->get_instance_id());
+    clear_scene_node_cache();
 
-        state->_clear_connections();
-        if (ObjectDB::get_instance(state_id)) {
-            state->_clear_stack();
+    {
+        MutexLock lock(*OScriptLanguage::get_singleton()->func_state_lock.ptr());
+        while (SelfList<OScriptFunctionState>* E = _pending_func_states.first()) {
+            // Order matters since clearing the stack may already cause the OScriptFunctionState to
+            // be destroyed and thus removed from the list.
+            _pending_func_states.remove(E);
+
+            OScriptFunctionState* state = E->self();
+            ObjectID state_id = ObjectID(state->get_instance_id());
+
+            state->_clear_connections();
+            if (ObjectDB::get_instance(state_id)) {
+                state->_clear_stack();
+            }
         }
     }
 
+    MutexLock lock(*OScriptLanguage::get_singleton()->lock.ptr());
     if (_script.is_valid() && _owner) {
         _script->instances.erase(_owner);
     }
@@ -28,6 +28,10 @@
 
 using namespace godot;
 
+namespace godot {
+    class Node;
+}
+
 typedef GDExtensionScriptInstanceInfo3 OScriptInstanceInfo;
 #define GDEXTENSION_SCRIPT_INSTANCE_CREATE GDE_INTERFACE(script_instance_create3)
 
@@ -97,13 +101,30 @@ class OScriptInstance : public OScriptInstanceBase {
     friend class OScriptCompiler;
     friend class OScriptCompiledFunction;
 
+    struct SceneNodeCacheEntry {
+        Node* node = nullptr;
+        ObjectID node_id;
+        Callable invalidate;
+    };
+
+    /// Scene nodes resolved by one script of the instance's hierarchy, indexed by compiler slot.
+    struct SceneNodeCache {
+        const OScript* script = nullptr;
+        LocalVector<SceneNodeCacheEntry> entries;
+    };
+
     Vector<Variant> _members;
+    LocalVector<SceneNodeCache> _scene_node_caches;
     SelfList<OScriptFunctionState>::List _pending_func_states;
+    StringName _owner_class; // Resolved on first native member access, see get_owner_class
+    bool _owner_class_resolved = false;
     #ifdef DEBUG_ENABLED
-    HashMap<StringName, int> _member_indices_cache;
+    Dictionary _member_indices_cache; // The script's member indices when the instance was created
     #endif
 
     void _call_implicit_ready_recursively(const OScript* p_script);
+    void _clear_scene_node_cache_entry(SceneNodeCacheEntry& r_entry);
+    void _invalidate_scene_node(const OScript* p_script, uint32_t p_slot);
 
 protected:
     //~ Begin OScriptInstanceBase Interface
@@ -129,6 +150,40 @@ public:
 
     Variant debug_get_member_by_index(int p_index) { return _members[p_index]; }
 
+    _FORCE_INLINE_ const StringName& get_owner_class() {
+        if (unlikely(!_owner_class_resolved)) {
+            _owner_class = _owner->get_class();
+            _owner_class_resolved = true;
+        }
+        return _owner_class;
+    }
+
+    /// Get a scene node previously resolved by <code>resolve_scene_node</code>.
+    /// @param p_script the script whose function requests the node
+    /// @param p_slot the compiler assigned slot of the node path within the script
+    /// @return the cached node, or null if the slot has not been resolved or was invalidated
+    _FORCE_INLINE_ Node* get_cached_scene_node(const OScript* p_script, int p_slot) const {
+        for (const SceneNodeCache& cache : _scene_node_caches) {
+            if (cache.script == p_script) {
+                return (uint32_t)p_slot < cache.entries.size() ? cache.entries[p_slot].node : nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Resolves a scene node relative to the owner, caching it while both are inside the tree.
+    /// Only single name paths, such as a child or a <code>%Unique</code> node, are cached. The
+    /// entry is invalidated when the node exits the tree or is renamed, and all entries are
+    /// invalidated when the owner exits the tree.
+    /// @param p_script the script whose function requests the node
+    /// @param p_slot the compiler assigned slot of the node path within the script
+    /// @param p_path the node path
+    /// @return the resolved node, or null if no node exists at the path
+    Node* resolve_scene_node(const OScript* p_script, int p_slot, const NodePath& p_path);
+
+    /// Drops all cached scene node references.
+    void clear_scene_node_cache();
+
     void reload_members();
 
     OScriptInstance(const Ref<OScript>& p_script, Object* p_owner);
@@ -27,11 +27,14 @@
 
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/time.hpp>
 #include <godot_cpp/core/mutex_lock.hpp>
 #include <godot_cpp/variant/variant_internal.hpp>
 
+#include <atomic>
+
 using namespace godot;
 
 // Aligned with e304b4e43e5d2f5027ab0c475b3f2530e81db207
@@ -276,6 +279,33 @@ void (*type_init_function_table[])(Variant*) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_ADD_INT_INT,                            \
+		&&OPCODE_SUB_INT_INT,                            \
+		&&OPCODE_MUL_INT_INT,                            \
+		&&OPCODE_EQUAL_INT_INT,                          \
+		&&OPCODE_NOT_EQUAL_INT_INT,                      \
+		&&OPCODE_LESS_INT_INT,                           \
+		&&OPCODE_LESS_EQUAL_INT_INT,                     \
+		&&OPCODE_GREATER_INT_INT,                        \
+		&&OPCODE_GREATER_EQUAL_INT_INT,                  \
+		&&OPCODE_ADD_FLOAT_FLOAT,                        \
+		&&OPCODE_SUB_FLOAT_FLOAT,                        \
+		&&OPCODE_MUL_FLOAT_FLOAT,                        \
+		&&OPCODE_DIV_FLOAT_FLOAT,                        \
+		&&OPCODE_LESS_FLOAT_FLOAT,                       \
+		&&OPCODE_LESS_EQUAL_FLOAT_FLOAT,                 \
+		&&OPCODE_GREATER_FLOAT_FLOAT,                    \
+		&&OPCODE_GREATER_EQUAL_FLOAT_FLOAT,              \
+		&&OPCODE_ADD_VECTOR2_VECTOR2,                    \
+		&&OPCODE_SUB_VECTOR2_VECTOR2,                    \
+		&&OPCODE_MUL_VECTOR2_VECTOR2,                    \
+		&&OPCODE_MUL_VECTOR2_FLOAT,                      \
+		&&OPCODE_DIV_VECTOR2_FLOAT,                      \
+		&&OPCODE_ADD_VECTOR3_VECTOR3,                    \
+		&&OPCODE_SUB_VECTOR3_VECTOR3,                    \
+		&&OPCODE_MUL_VECTOR3_VECTOR3,                    \
+		&&OPCODE_MUL_VECTOR3_FLOAT,                      \
+		&&OPCODE_DIV_VECTOR3_FLOAT,                      \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -295,6 +325,7 @@ void (*type_init_function_table[])(Variant*) = {
 		&&OPCODE_GET_MEMBER,                             \
 		&&OPCODE_SET_STATIC_VARIABLE,                    \
 		&&OPCODE_GET_STATIC_VARIABLE,                    \
+		&&OPCODE_GET_SCENE_NODE,                         \
 		&&OPCODE_ASSIGN,                                 \
 		&&OPCODE_ASSIGN_NULL,                            \
 		&&OPCODE_ASSIGN_TRUE,                            \
@@ -321,6 +352,8 @@ void (*type_init_function_table[])(Variant*) = {
 		&&OPCODE_CALL_OSCRIPT_UTILITY,                   \
 		&&OPCODE_CALL_BUILTIN_TYPE_VALIDATED,            \
 		&&OPCODE_CALL_SELF_BASE,                         \
+		&&OPCODE_CALL_OSCRIPT_FUNCTION,                  \
+		&&OPCODE_CALL_OSCRIPT_FUNCTION_RETURN,           \
 		&&OPCODE_CALL_METHOD_BIND,                       \
 		&&OPCODE_CALL_METHOD_BIND_RET,                   \
 		&&OPCODE_CALL_BUILTIN_STATIC,                    \
@@ -330,6 +363,7 @@ void (*type_init_function_table[])(Variant*) = {
 		&&OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN,      \
 		&&OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN,   \
 		&&OPCODE_AWAIT,                                  \
+		&&OPCODE_AWAIT_DELAY,                            \
 		&&OPCODE_AWAIT_RESUME,                           \
 		&&OPCODE_CREATE_LAMBDA,                          \
 		&&OPCODE_CREATE_SELF_LAMBDA,                     \
@@ -338,6 +372,7 @@ void (*type_init_function_table[])(Variant*) = {
 		&&OPCODE_JUMP_IF_NOT,                            \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                   \
 		&&OPCODE_JUMP_IF_SHARED,                         \
+		&&OPCODE_SWITCH,                                 \
 		&&OPCODE_RETURN,                                 \
 		&&OPCODE_RETURN_TYPED_BUILTIN,                   \
 		&&OPCODE_RETURN_TYPED_ARRAY,                     \
@@ -540,6 +575,68 @@ void (*type_init_function_table[])(Variant*) = {
         p_base->callp(*p_method, p_args, p_arg_count, r_ret, r_error); \
     }
 
+Ref<OScriptFunctionState> OScriptCompiledFunction::_suspend(OScriptInstance* p_instance, const Signal& p_completed,
+    Variant* p_stack, uint32_t p_alloca_size, int p_ip, int p_node, int p_defarg) {
+
+    Ref<OScriptFunctionState> ofs = memnew(OScriptFunctionState);
+    ofs->function = this;
+
+    {
+        MutexLock lock(*OScriptLanguage::get_singleton()->func_state_lock.ptr());
+        if (!_state_stack_pool.is_empty()) {
+            const uint32_t last = _state_stack_pool.size() - 1;
+            ofs->state.stack = _state_stack_pool[last];
+            _state_stack_pool.resize(last);
+        }
+
+        _script->pending_func_states.add(&ofs->scripts_list);
+        if (p_instance) {
+            p_instance->_pending_func_states.add(&ofs->instances_list);
+        }
+    }
+
+    ofs->state.stack.resize(p_alloca_size);
+
+    // The suspended call exits right after this, so the stack is moved rather than copied.
+    // First `FIXED_ADDRESSES_MAX` stack addresses are special, so we just skip them here.
+    Variant* state_stack = reinterpret_cast<Variant*>(ofs->state.stack.ptrw());
+    for (int i = FIXED_ADDRESSES_MAX; i < stack_size; i++) {
+        memnew_placement(&state_stack[i], Variant(std::move(p_stack[i])));
+    }
+
+    ofs->state.stack_size = stack_size;
+    ofs->state.ip = p_ip;
+    ofs->state.node_id = p_node;
+    ofs->state.script = _script;
+    ofs->state.instance = p_instance;
+    ofs->state.defarg = p_defarg;
+    #ifdef DEBUG_ENABLED
+    ofs->state.function_name = name;
+    ofs->state.script_path = _script->get_script_path();
+    #endif
+
+    if (!p_completed.is_null()) {
+        // Pass down the signal from the first state.
+        ofs->state.completed = p_completed;
+    } else {
+        ofs->state.completed = Signal(ofs.ptr(), StringName("completed"));
+    }
+
+    return ofs;
+}
+
+void OScriptCompiledFunction::_release_state_stack(Vector<uint8_t>& r_stack) {
+    if (r_stack.is_empty()) {
+        return;
+    }
+
+    MutexLock lock(*OScriptLanguage::get_singleton()->func_state_lock.ptr());
+    if (_state_stack_pool.size() < MAX_POOLED_STATE_STACKS) {
+        _state_stack_pool.push_back(r_stack);
+    }
+    r_stack = Vector<uint8_t>();
+}
+
 Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant** p_args, int p_arg_count, GDExtensionCallError& r_error, CallState* p_state) {
     OPCODES_TABLE;
 
@@ -625,12 +722,18 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
         alloca_size = vsize * FIXED_ADDRESSES_MAX + vsize * instruction_arg_size + sizeof(Variant) * stack_size;
 
         uint8_t* aptr = static_cast<uint8_t*>(alloca(alloca_size));
-        memset(aptr, 0, alloca_size);
         stack = reinterpret_cast<Variant*>(aptr);
 
         const int non_vararg_arg_count = MIN(p_arg_count, argument_count);
+
+        // A nil Variant is all zero bytes, so only the slots past the passed arguments are cleared
+        // and the fixed addresses and arguments are constructed in place.
+        const size_t constructed_size = sizeof(Variant) * (FIXED_ADDRESSES_MAX + non_vararg_arg_count);
+        memset(aptr + constructed_size, 0, alloca_size - constructed_size);
+
+        const ArgumentCheck* checks = argument_checks.ptr();
         for (int i = 0; i < non_vararg_arg_count; i++) {
-            if (!argument_types[i].has_type()) {
+            if (untyped_arguments || checks[i] == ARGUMENT_UNTYPED) {
                 memnew_placement(&stack[i + FIXED_ADDRESSES_MAX], Variant(*p_args[i]));
                 continue;
             }
@@ -638,7 +741,12 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             // If types already match, don't call Variant::construct(). Constructors of some
             // types (e.g. packed arrays) do copies, whereas they pass a reference when used
             // inside a Variant.
-            if (argument_types[i].is_type(*p_args[i], false)) {
+            if (checks[i] == ARGUMENT_BUILTIN && p_args[i]->get_type() == argument_types[i].builtin_type) {
+                memnew_placement(&stack[i + FIXED_ADDRESSES_MAX], Variant(*p_args[i]));
+                continue;
+            }
+
+            if (checks[i] == ARGUMENT_CHECKED && argument_types[i].is_type(*p_args[i], false)) {
                 memnew_placement(&stack[i + FIXED_ADDRESSES_MAX], Variant(*p_args[i]));
                 continue;
             }
@@ -680,10 +788,6 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             }
         }
 
-        for (int i = non_vararg_arg_count + FIXED_ADDRESSES_MAX; i < stack_size; i++) {
-            memnew_placement(&stack[i], Variant);
-        }
-
         if (is_vararg()) {
             Array vararg;
             stack[vararg_index] = vararg;
@@ -701,11 +805,11 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             instruction_args = nullptr;
         }
 
-        for (const KeyValue<int, Variant::Type>& E : temporary_slots) {
+        for (const TypedSlot& typed_slot : typed_slots) {
             #ifdef USE_TYPE_INIT_FUNCTION_TABLE
-            type_init_function_table[E.value](&stack[E.key]);
+            type_init_function_table[typed_slot.type](&stack[typed_slot.slot]);
             #endif
-            GDE::VariantInternal::initialize(&stack[E.key], E.value);
+            GDE::VariantInternal::initialize(&stack[typed_slot.slot], typed_slot.type);
         }
     }
 
@@ -789,9 +893,13 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
     #ifdef DEBUG_ENABLED
     uint64_t function_start_time = 0;
     uint64_t function_call_time = 0;
+    // A resumed call continues timing the node that awaited.
+    int profile_node = p_state ? node : -1;
+    uint64_t profile_node_start_time = 0;
     if (OScriptLanguage::get_singleton()->profiling) {
         function_start_time = Time::get_singleton()->get_ticks_usec();
         function_call_time = 0;
+        profile_node_start_time = function_start_time;
         profile.call_count.increment();
         profile.frame_call_count.increment();
     }
@@ -811,11 +919,10 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
 
         OPCODE_SWITCH(code_ptr[ip]) {
             // todo:
-            //  Currently GDExtension cannot use validated function pointers for operator calls and there
-            //  are special requirements about the value types that can be used with non-validated function
-            //  pointers. To avoid that issue for now, a new OPCODE_OPERATOR_EVALUATE is added here as a
-            //  short-term answer to provide a common way to manage arithmetic VM operations. This is a bit
-            //  slower than the validated function pointers, but it is what it is.
+            //  GDExtension validated operator evaluators work on a value's internal data rather than on the
+            //  Variant, so they cannot be resolved at compile time like GDScript does. OPCODE_OPERATOR resolves
+            //  them on first execution with the internal pointer getters for the observed operand types, while
+            //  OPCODE_OPERATOR_EVALUATE remains as the plain Variant evaluation path.
             OPCODE(OPCODE_OPERATOR_EVALUATE) {
                 CHECK_SPACE(5);
 
@@ -827,16 +934,13 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
                 GET_VARIANT_PTR(dst, 2);
 
                 bool valid = true;
-
-                Variant ret;
-                Variant::evaluate(op, *a, *b, ret, valid);
-                *dst = ret;
+                GDE::VariantInternal::evaluate(op, a, b, dst, valid);
 
                 #ifdef DEBUG_ENABLED
                 if (!valid) {
-                    if (ret.get_type() == Variant::STRING) {
+                    if (dst->get_type() == Variant::STRING) {
                         // return a string when invalid with the error
-                        error_text = ret;
+                        error_text = *dst;
                         error_text += " in operator '" + GDE::Variant::get_operator_name(op) + "'.";
                     } else {
                         error_text = "Invalid operands '" + Variant::get_type_name(a->get_type()) + "' and '" +
@@ -851,8 +955,7 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             DISPATCH_OPCODE;
 
             OPCODE(OPCODE_OPERATOR) {
-                constexpr int pointer_size = sizeof(GDExtensionInterfaceVariantEvaluate) / sizeof(*code_ptr);
-                CHECK_SPACE(7 + pointer_size);
+                CHECK_SPACE(7);
 
                 bool valid;
                 Variant::Operator op = static_cast<Variant::Operator>(code_ptr[ip + 4]);
@@ -862,70 +965,47 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
                 GET_VARIANT_PTR(b, 1);
                 GET_VARIANT_PTR(dst, 2);
 
-                uint32_t op_signature = code_ptr[ip + 5];
-                uint32_t actual_signature = (a->get_type() << 8) | (b->get_type());
-
-                #ifdef DEBUG_ENABLED
-                if (op == Variant::OP_DIVIDE || op == Variant::OP_MODULE) {
-                    // Do no optimize division and modulo since there is no check for division by zero with validated calls
-                    op_signature = 0xFFFF;
-                    code_ptr[ip + 5] = op_signature;
+                const int cache_index = code_ptr[ip + 6];
+                OSCRIPT_ERR_BREAK(cache_index < 0 || cache_index >= operator_caches_count);
+
+                std::atomic_ref<int> signature_slot(code_ptr[ip + 5]);
+                int op_signature = signature_slot.load(std::memory_order_acquire);
+                const int actual_signature = (a->get_type() << 8) | b->get_type();
+
+                // The first thread to execute the instruction resolves an evaluator for the operand types it sees,
+                // and publishes the signature once the cache entry is written. Until then, other threads use the
+                // generic path.
+                if (unlikely(op_signature == OPERATOR_SIGNATURE_UNRESOLVED)) {
+                    if (signature_slot.compare_exchange_strong(op_signature, OPERATOR_SIGNATURE_PENDING, std::memory_order_acq_rel)) {
+                        const bool resolved = _resolve_operator_cache(operator_caches_ptr[cache_index], op, a->get_type(), b->get_type());
+                        op_signature = resolved ? actual_signature : OPERATOR_SIGNATURE_GENERIC;
+                        signature_slot.store(op_signature, std::memory_order_release);
+                    }
                 }
-                #endif
-
-                // Check if this is the first run, and store the current signature for the optimized path if so.
-                if (unlikely(op_signature == 0)) {
-                    static Ref<Mutex> initializer_mutex;
-                    initializer_mutex.instantiate();
-                    initializer_mutex->lock();
 
-                    Variant::Type a_type = GDE::Variant::as_type((actual_signature >> 8) & 0xFF);
-                    Variant::Type b_type = GDE::Variant::as_type(actual_signature & 0xFF);
-
-                    GDExtensionPtrOperatorEvaluator op_func = GDE::Variant::get_validated_operator_evaluator(op, a_type, b_type);
-                    if (unlikely(!op_func)) {
-                        #ifdef DEBUG_ENABLED
-                        error_text = "Invalid operands '" + Variant::get_type_name(a->get_type()) + "' and '" +
-                            Variant::get_type_name(b->get_type()) + "' in operator '" + GDE::Variant::get_operator_name(op) + "'.";
-                        #endif
-                        initializer_mutex->unlock();
-                        OPCODE_BREAK;
-                    } else {
-                        Variant::Type ret_type = GDE::Variant::get_operator_return_type(op, a_type, b_type);
-                        GDE::VariantInternal::initialize(dst, ret_type);
-                        op_func(a, b, dst);
-
-                        // Check if another thread already set it.
-                        if (code_ptr[ip + 5] == 0) {
-                            code_ptr[ip + 5] = actual_signature;
-                            code_ptr[ip + 6] = static_cast<int>(ret_type);
-
-                            GDExtensionPtrOperatorEvaluator* tmp = reinterpret_cast<GDExtensionPtrOperatorEvaluator*>(&code_ptr[ip + 7]);
-                            *tmp = op_func;
+                const OperatorCache* cache = nullptr;
+                if (likely(op_signature == actual_signature)) {
+                    cache = &operator_caches_ptr[cache_index];
+                    if (unlikely(dst->get_type() != cache->return_type)) {
+                        if (dst == a || dst == b) {
+                            // Changing the destination type would destroy an operand
+                            cache = nullptr;
+                        } else {
+                            GDE::VariantInternal::reinitialize(dst, cache->return_type);
                         }
                     }
+                }
 
-                    initializer_mutex->unlock();
-                } else if (likely(op_signature == actual_signature)) {
-                    // If signatures match, use optimized path
-                    Variant::Type ret_type = GDE::Variant::as_type(code_ptr[ip + 6]);
-                    GDExtensionPtrOperatorEvaluator op_func = *reinterpret_cast<GDExtensionPtrOperatorEvaluator*>(&code_ptr[ip + 7]);
-                    // Make sure return value has correct type
-                    GDE::VariantInternal::initialize(dst, ret_type);
-                    op_func(a, b, dst);
+                if (likely(cache)) {
+                    cache->evaluator(cache->left(a), cache->right ? cache->right(b) : nullptr, cache->result(dst));
                 } else {
                     // If signatures don't match, we have to use the slow path
-                    #ifdef DEBUG_ENABLED
-                    Variant ret;
-                    Variant::evaluate(op, *a, *b, ret, valid);
-                    #else
-                    Variant::evaluate(op, *a, *b, *dst, valid);
-                    #endif
+                    GDE::VariantInternal::evaluate(op, a, b, dst, valid);
                     #ifdef DEBUG_ENABLED
                     if (!valid) {
-                        if (ret.get_type() == Variant::STRING) {
+                        if (dst->get_type() == Variant::STRING) {
                             // return a string when invalid with the error
-                            error_text = ret;
+                            error_text = *dst;
                             error_text += " in operator '" + GDE::Variant::get_operator_name(op) + "'.";
                         } else {
                             error_text = "Invalid operands '" + Variant::get_type_name(a->get_type()) + "' and '" +
@@ -933,10 +1013,9 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
                         }
                         OPCODE_BREAK;
                     }
-                    *dst = ret;
                     #endif
                 }
-                ip += 7 + pointer_size;
+                ip += 7;
             }
             DISPATCH_OPCODE;
 
@@ -957,6 +1036,73 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             }
             DISPATCH_OPCODE;
 
+#ifdef DEBUG_ENABLED
+#define OPCODE_TYPED_OPERATOR_INVALID(m_op)                                                                         \
+	if (!valid) {                                                                                                   \
+		error_text = "Invalid operands '" + Variant::get_type_name(a->get_type()) + "' and '" +                     \
+			Variant::get_type_name(b->get_type()) + "' in operator '" + GDE::Variant::get_operator_name(Variant::m_op) + "'."; \
+		OPCODE_BREAK;                                                                                               \
+	}
+#else
+#define OPCODE_TYPED_OPERATOR_INVALID(m_op)
+#endif
+
+// The check stays in release builds, as reading a payload of the wrong type is undefined behavior. When an
+// operand is not of the proven type, such as after a stack slot is reused, the operator is evaluated generically.
+#define OPCODE_TYPED_OPERATOR_CHECK(m_op, m_left_type, m_right_type)                                               \
+	if (unlikely(a->get_type() != Variant::m_left_type || b->get_type() != Variant::m_right_type)) {               \
+		bool valid;                                                                                                 \
+		GDE::VariantInternal::evaluate(Variant::m_op, a, b, dst, valid);                                            \
+		OPCODE_TYPED_OPERATOR_INVALID(m_op)                                                                         \
+		ip += 4;                                                                                                    \
+		DISPATCH_OPCODE;                                                                                            \
+	}
+
+// Operand types are proven by the analyzer, so once checked the operation works directly on the Variant payloads.
+#define OPCODE_TYPED_OPERATOR(m_name, m_op, m_operator, m_left_type, m_left_get, m_right_type, m_right_get, m_ret_type, m_ret_get) \
+	OPCODE(OPCODE_##m_name) {                                                                                       \
+		CHECK_SPACE(4);                                                                                             \
+		GET_VARIANT_PTR(a, 0);                                                                                      \
+		GET_VARIANT_PTR(b, 1);                                                                                      \
+		GET_VARIANT_PTR(dst, 2);                                                                                    \
+		OPCODE_TYPED_OPERATOR_CHECK(m_op, m_left_type, m_right_type)                                                \
+		const auto result = *VariantInternal::m_left_get(a) m_operator *VariantInternal::m_right_get(b);            \
+		if (unlikely(dst->get_type() != Variant::m_ret_type)) {                                                     \
+			GDE::VariantInternal::reinitialize(dst, Variant::m_ret_type);                                           \
+		}                                                                                                           \
+		*VariantInternal::m_ret_get(dst) = result;                                                                  \
+		ip += 4;                                                                                                    \
+	}                                                                                                               \
+	DISPATCH_OPCODE
+
+            OPCODE_TYPED_OPERATOR(ADD_INT_INT, OP_ADD, +, INT, get_int, INT, get_int, INT, get_int);
+            OPCODE_TYPED_OPERATOR(SUB_INT_INT, OP_SUBTRACT, -, INT, get_int, INT, get_int, INT, get_int);
+            OPCODE_TYPED_OPERATOR(MUL_INT_INT, OP_MULTIPLY, *, INT, get_int, INT, get_int, INT, get_int);
+            OPCODE_TYPED_OPERATOR(EQUAL_INT_INT, OP_EQUAL, ==, INT, get_int, INT, get_int, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(NOT_EQUAL_INT_INT, OP_NOT_EQUAL, !=, INT, get_int, INT, get_int, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(LESS_INT_INT, OP_LESS, <, INT, get_int, INT, get_int, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(LESS_EQUAL_INT_INT, OP_LESS_EQUAL, <=, INT, get_int, INT, get_int, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(GREATER_INT_INT, OP_GREATER, >, INT, get_int, INT, get_int, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(GREATER_EQUAL_INT_INT, OP_GREATER_EQUAL, >=, INT, get_int, INT, get_int, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(ADD_FLOAT_FLOAT, OP_ADD, +, FLOAT, get_float, FLOAT, get_float, FLOAT, get_float);
+            OPCODE_TYPED_OPERATOR(SUB_FLOAT_FLOAT, OP_SUBTRACT, -, FLOAT, get_float, FLOAT, get_float, FLOAT, get_float);
+            OPCODE_TYPED_OPERATOR(MUL_FLOAT_FLOAT, OP_MULTIPLY, *, FLOAT, get_float, FLOAT, get_float, FLOAT, get_float);
+            OPCODE_TYPED_OPERATOR(DIV_FLOAT_FLOAT, OP_DIVIDE, /, FLOAT, get_float, FLOAT, get_float, FLOAT, get_float);
+            OPCODE_TYPED_OPERATOR(LESS_FLOAT_FLOAT, OP_LESS, <, FLOAT, get_float, FLOAT, get_float, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(LESS_EQUAL_FLOAT_FLOAT, OP_LESS_EQUAL, <=, FLOAT, get_float, FLOAT, get_float, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(GREATER_FLOAT_FLOAT, OP_GREATER, >, FLOAT, get_float, FLOAT, get_float, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(GREATER_EQUAL_FLOAT_FLOAT, OP_GREATER_EQUAL, >=, FLOAT, get_float, FLOAT, get_float, BOOL, get_bool);
+            OPCODE_TYPED_OPERATOR(ADD_VECTOR2_VECTOR2, OP_ADD, +, VECTOR2, get_vector2, VECTOR2, get_vector2, VECTOR2, get_vector2);
+            OPCODE_TYPED_OPERATOR(SUB_VECTOR2_VECTOR2, OP_SUBTRACT, -, VECTOR2, get_vector2, VECTOR2, get_vector2, VECTOR2, get_vector2);
+            OPCODE_TYPED_OPERATOR(MUL_VECTOR2_VECTOR2, OP_MULTIPLY, *, VECTOR2, get_vector2, VECTOR2, get_vector2, VECTOR2, get_vector2);
+            OPCODE_TYPED_OPERATOR(MUL_VECTOR2_FLOAT, OP_MULTIPLY, *, VECTOR2, get_vector2, FLOAT, get_float, VECTOR2, get_vector2);
+            OPCODE_TYPED_OPERATOR(DIV_VECTOR2_FLOAT, OP_DIVIDE, /, VECTOR2, get_vector2, FLOAT, get_float, VECTOR2, get_vector2);
+            OPCODE_TYPED_OPERATOR(ADD_VECTOR3_VECTOR3, OP_ADD, +, VECTOR3, get_vector3, VECTOR3, get_vector3, VECTOR3, get_vector3);
+            OPCODE_TYPED_OPERATOR(SUB_VECTOR3_VECTOR3, OP_SUBTRACT, -, VECTOR3, get_vector3, VECTOR3, get_vector3, VECTOR3, get_vector3);
+            OPCODE_TYPED_OPERATOR(MUL_VECTOR3_VECTOR3, OP_MULTIPLY, *, VECTOR3, get_vector3, VECTOR3, get_vector3, VECTOR3, get_vector3);
+            OPCODE_TYPED_OPERATOR(MUL_VECTOR3_FLOAT, OP_MULTIPLY, *, VECTOR3, get_vector3, FLOAT, get_float, VECTOR3, get_vector3);
+            OPCODE_TYPED_OPERATOR(DIV_VECTOR3_FLOAT, OP_DIVIDE, /, VECTOR3, get_vector3, FLOAT, get_float, VECTOR3, get_vector3);
+
             OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
                 CHECK_SPACE(4);
 
@@ -1323,37 +1469,81 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             DISPATCH_OPCODE;
 
             OPCODE(OPCODE_SET_MEMBER) {
-                CHECK_SPACE(3);
+                CHECK_SPACE(4);
                 GET_VARIANT_PTR(src, 0);
 
                 const int indexname = code_ptr[ip + 2];
                 OSCRIPT_ERR_BREAK(indexname < 0 || indexname >= global_names_count);
                 const StringName *index = &global_names_ptr[indexname];
 
-                Error error = ClassDB::class_set_property(p_instance->_owner, *index, *src);
-                #ifdef DEBUG_ENABLED
-                if (error != OK) {
-                    error_text = "Internal error setting property: " + String(*index);
-                    OPCODE_BREAK;
+                const int cache_index = code_ptr[ip + 3];
+                OSCRIPT_ERR_BREAK(cache_index < 0 || cache_index >= member_caches_count);
+
+                const StringName& owner_class = p_instance->get_owner_class();
+                MemberAccessCache* cache = std::atomic_ref<MemberAccessCache*>(member_caches_ptr[cache_index]).load(std::memory_order_acquire);
+                if (unlikely(!cache)) {
+                    cache = _get_member_access_cache(cache_index, owner_class, *index, true);
                 }
-                #endif
 
-                ip += 3;
+                if (likely(cache->method && cache->owner_class == owner_class)) {
+                    const Variant* args[1] = { src };
+                    Variant ret;
+                    GDExtensionCallError err;
+                    GDE_INTERFACE(object_method_bind_call)(
+                        cache->method, p_instance->_owner->_owner, reinterpret_cast<const GDExtensionConstVariantPtr*>(args), 1, &ret, &err);
+                    #ifdef DEBUG_ENABLED
+                    if (err.error != GDEXTENSION_CALL_OK) {
+                        error_text = "Internal error setting property: " + String(*index);
+                        OPCODE_BREAK;
+                    }
+                    #endif
+                } else {
+                    Error error = ClassDB::class_set_property(p_instance->_owner, *index, *src);
+                    #ifdef DEBUG_ENABLED
+                    if (error != OK) {
+                        error_text = "Internal error setting property: " + String(*index);
+                        OPCODE_BREAK;
+                    }
+                    #endif
+                }
+
+                ip += 4;
             }
             DISPATCH_OPCODE;
 
             OPCODE(OPCODE_GET_MEMBER) {
-                CHECK_SPACE(3);
+                CHECK_SPACE(4);
                 GET_VARIANT_PTR(dst, 0);
 
                 const int indexname = code_ptr[ip + 2];
                 OSCRIPT_ERR_BREAK(indexname < 0 || indexname >= global_names_count);
                 const StringName *index = &global_names_ptr[indexname];
 
-                *dst = ClassDB::class_get_property(p_instance->_owner, *index);
+                const int cache_index = code_ptr[ip + 3];
+                OSCRIPT_ERR_BREAK(cache_index < 0 || cache_index >= member_caches_count);
 
-                // todo: how to validate?
-                ip += 3;
+                const StringName& owner_class = p_instance->get_owner_class();
+                MemberAccessCache* cache = std::atomic_ref<MemberAccessCache*>(member_caches_ptr[cache_index]).load(std::memory_order_acquire);
+                if (unlikely(!cache)) {
+                    cache = _get_member_access_cache(cache_index, owner_class, *index, false);
+                }
+
+                if (likely(cache->method && cache->owner_class == owner_class)) {
+                    Variant ret;
+                    GDExtensionCallError err;
+                    GDE_INTERFACE(object_method_bind_call)(cache->method, p_instance->_owner->_owner, nullptr, 0, &ret, &err);
+                    #ifdef DEBUG_ENABLED
+                    if (err.error != GDEXTENSION_CALL_OK) {
+                        error_text = "Internal error getting property: " + String(*index);
+                        OPCODE_BREAK;
+                    }
+                    #endif
+                    *dst = ret;
+                } else {
+                    *dst = ClassDB::class_get_property(p_instance->_owner, *index);
+                }
+
+                ip += 4;
             }
             DISPATCH_OPCODE;
 
@@ -1393,6 +1583,25 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             }
             DISPATCH_OPCODE;
 
+            OPCODE(OPCODE_GET_SCENE_NODE) {
+                CHECK_SPACE(4);
+
+                GET_VARIANT_PTR(target, 0);
+                GET_VARIANT_PTR(path, 1);
+
+                const int slot = code_ptr[ip + 3];
+                OSCRIPT_ERR_BREAK(slot < 0 || !p_instance);
+
+                Node* node = p_instance->get_cached_scene_node(_script, slot);
+                if (unlikely(!node)) {
+                    node = p_instance->resolve_scene_node(_script, slot, *path);
+                }
+                *target = node;
+
+                ip += 4;
+            }
+            DISPATCH_OPCODE;
+
             OPCODE(OPCODE_ASSIGN) {
                 CHECK_SPACE(3);
                 GET_VARIANT_PTR(dst, 0);
@@ -2578,6 +2787,78 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             }
             DISPATCH_OPCODE;
 
+            OPCODE(OPCODE_CALL_OSCRIPT_FUNCTION_RETURN)
+            OPCODE(OPCODE_CALL_OSCRIPT_FUNCTION) {
+                #ifdef DEBUG_ENABLED
+                bool call_ret = code_ptr[ip] == OPCODE_CALL_OSCRIPT_FUNCTION_RETURN;
+                #endif
+
+                LOAD_INSTRUCTION_ARGS
+                CHECK_SPACE(4 + instr_arg_count);
+
+                ip += instr_arg_count;
+
+                const int argc = code_ptr[ip + 1];
+                OSCRIPT_ERR_BREAK(argc < 0);
+
+                const int methodname_idx = code_ptr[ip + 2];
+                OSCRIPT_ERR_BREAK(methodname_idx < 0 || methodname_idx >= global_names_count);
+                const StringName* methodname = &global_names_ptr[methodname_idx];
+
+                const int function_idx = code_ptr[ip + 3];
+                OSCRIPT_ERR_BREAK(function_idx < 0 || function_idx >= oscript_functions_count);
+
+                Variant** argptrs = instruction_args;
+                GET_INSTRUCTION_ARG(dst, argc);
+
+                #ifdef DEBUG_ENABLED
+                uint64_t call_time = 0;
+                if (OScriptLanguage::get_singleton()->profiling) {
+                    call_time = Time::get_singleton()->get_ticks_usec();
+                }
+                #endif
+
+                // The function pointer is linked at compile time against this script's member functions.
+                // It can only be used when the instance is exactly this script, otherwise a derived script
+                // may override the function and the call must be dispatched by name.
+                OScriptCompiledFunction* target = oscript_functions_ptr[function_idx];
+
+                Variant temp_ret;
+                GDExtensionCallError err;
+                if (target && p_instance && p_instance->_script.ptr() == _script) {
+                    temp_ret = target->call(p_instance, (const Variant**)argptrs, argc, err);
+                } else {
+                    Variant* base = &stack[ADDR_STACK_SELF];
+                    BASE_CALLP_HELPER(base, methodname, (const Variant**)argptrs, argc, temp_ret, err);
+                }
+                *dst = temp_ret;
+
+                #ifdef DEBUG_ENABLED
+                if (OScriptLanguage::get_singleton()->profiling) {
+                    function_call_time += Time::get_singleton()->get_ticks_usec() - call_time;
+                }
+
+                if (err.error != GDEXTENSION_CALL_OK) {
+                    String methodstr = *methodname;
+                    error_text = get_call_error("function '" + methodstr + "'", (const Variant **)argptrs, argc, *dst, err);
+                    OPCODE_BREAK;
+                }
+
+                if (call_ret && dst->get_type() == Variant::OBJECT) {
+                    // Check if getting a function state without await.
+                    bool was_freed = false;
+                    Object* obj = GDE::Variant::get_validated_object_with_check(*dst, was_freed);
+                    if (obj && obj->get_class() == OScriptFunctionState::get_class_static()) {
+                        error_text = R"(Trying to call an async function without "await".)";
+                        OPCODE_BREAK;
+                    }
+                }
+                #endif
+
+                ip += 4;
+            }
+            DISPATCH_OPCODE;
+
             OPCODE(OPCODE_AWAIT) {
 				CHECK_SPACE(2);
 
@@ -2613,44 +2894,7 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
 				}
 
 				if (is_signal) {
-					Ref<OScriptFunctionState> ofs = memnew(OScriptFunctionState);
-					ofs->function = this;
-					ofs->state.stack.resize(alloca_size);
-
-					// First `FIXED_ADDRESSES_MAX` stack addresses are special, so we just skip them here.
-					for (int i = FIXED_ADDRESSES_MAX; i < stack_size; i++) {
-						memnew_placement(&ofs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
-					}
-					ofs->state.stack_size = stack_size;
-					ofs->state.ip = ip + 2;
-					ofs->state.node_id = node;
-					ofs->state.script = _script;
-
-					{
-						MutexLock lock(*OScriptLanguage::get_singleton()->lock.ptr());
-						_script->pending_func_states.add(&ofs->scripts_list);
-						if (p_instance) {
-							ofs->state.instance = p_instance;
-							p_instance->_pending_func_states.add(&ofs->instances_list);
-						} else {
-							ofs->state.instance = nullptr;
-						}
-					}
-
-                    #ifdef DEBUG_ENABLED
-					ofs->state.function_name = name;
-					ofs->state.script_path = _script->get_script_path();
-                    #endif
-					ofs->state.defarg = defarg;
-					ofs->function = this;
-
-					if (p_state) {
-						// Pass down the signal from the first state.
-						ofs->state.completed = p_state->completed;
-					} else {
-						ofs->state.completed = Signal(ofs.ptr(), StringName("completed"));
-					}
-
+					Ref<OScriptFunctionState> ofs = _suspend(p_instance, p_state ? p_state->completed : Signal(), stack, alloca_size, ip + 2, node, defarg);
 					retvalue = ofs;
 
 					int64_t err = sig.connect(Callable(ofs.ptr(), "_signal_callback").bind(retvalue), Object::CONNECT_ONE_SHOT);
@@ -2669,6 +2913,32 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
 			}
 			DISPATCH_OPCODE; // Needed for synchronous calls (when result is immediately available).
 
+            OPCODE(OPCODE_AWAIT_DELAY) {
+                CHECK_SPACE(2);
+                GET_VARIANT_PTR(duration, 0);
+
+                if (duration->get_type() != Variant::INT && duration->get_type() != Variant::FLOAT) {
+                    error_text = "Delay duration must be a number, got '" + Variant::get_type_name(duration->get_type()) + "'.";
+                    OPCODE_BREAK;
+                }
+
+                // Read before suspending, since the duration may live on the stack that is moved.
+                const double seconds = *duration;
+
+                Ref<OScriptFunctionState> ofs = _suspend(p_instance, p_state ? p_state->completed : Signal(), stack, alloca_size, ip + 2, node, defarg);
+                retvalue = ofs;
+
+                // The language's scheduler resumes the state directly, so no timer or signal connection is needed.
+                OScriptLanguage::get_singleton()->schedule_delay(ofs, seconds);
+
+                awaited = true;
+                #ifdef DEBUG_ENABLED
+                exit_ok = true;
+                #endif
+
+                OPCODE_BREAK;
+            }
+
             OPCODE(OPCODE_AWAIT_RESUME) {
                 CHECK_SPACE(2);
                 #ifdef DEBUG_ENABLED
@@ -2811,6 +3081,20 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
             }
             DISPATCH_OPCODE;
 
+            OPCODE(OPCODE_SWITCH) {
+                CHECK_SPACE(3);
+
+                GET_VARIANT_PTR(val, 0);
+
+                const int table = code_ptr[ip + 2];
+                OSCRIPT_ERR_BREAK(table < 0 || table >= switch_tables_count);
+
+                int to = switch_tables_ptr[table].find_target(val);
+                OSCRIPT_ERR_BREAK(to < 0 || to > code_size);
+                ip = to;
+            }
+            DISPATCH_OPCODE;
+
             OPCODE(OPCODE_RETURN) {
                 CHECK_SPACE(2);
                 GET_VARIANT_PTR(r, 0);
@@ -3954,7 +4238,7 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
 
             OPCODE(OPCODE_BREAKPOINT) {
                 #ifdef DEBUG_ENABLED
-                if (EngineDebugger::get_singleton()->is_active()) {
+                if (OScriptLanguage::get_singleton()->is_debugger_active()) {
                     OScriptLanguage::get_singleton()->debug_break("Breakpoint Statement", true);
                 }
                 #endif
@@ -3968,11 +4252,19 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
                 node = code_ptr[ip + 1];
                 ip += 2;
 
-                if (EngineDebugger::get_singleton()->is_active()) {
+                OScriptLanguage* language = OScriptLanguage::get_singleton();
+
+                #ifdef DEBUG_ENABLED
+                if (unlikely(language->profiling)) {
+                    _profile_node(node, profile_node, profile_node_start_time);
+                }
+                #endif
+
+                if (unlikely(language->is_debugger_active())) {
                     bool do_break = false;
 
                     EngineDebugger* debugger = EngineDebugger::get_singleton();
-                    if (unlikely(debugger->get_lines_left() > 0)) {
+                    if (unlikely(language->is_debugger_stepping())) {
                         if (debugger->get_depth() <= 0) {
                             debugger->set_lines_left(debugger->get_lines_left() - 1);
                         }
@@ -3981,15 +4273,16 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
                         }
                     }
 
-                    if (debugger->is_breakpoint(node, source)) {
+                    // Only functions with a breakpoint on one of their nodes query the debugger
+                    if (_has_breakpoints() && debugger->is_breakpoint(node, source)) {
                         do_break = true;
                     }
 
                     if (unlikely(do_break)) {
-                        OScriptLanguage::get_singleton()->debug_break("Breakpoint", true);
+                        language->debug_break("Breakpoint", true);
                     }
 
-                    EngineDebugger::get_singleton()->line_poll();
+                    language->debug_line_poll();
                 }
             }
             DISPATCH_OPCODE;
@@ -4049,6 +4342,8 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
 
     #ifdef DEBUG_ENABLED
     if (OScriptLanguage::get_singleton()->profiling) {
+        _profile_node(-1, profile_node, profile_node_start_time);
+
         uint64_t time_taken = Time::get_singleton()->get_ticks_usec() - function_start_time;
         profile.total_time.add(time_taken);
         profile.self_time.add(time_taken - function_call_time);
@@ -4075,6 +4370,12 @@ Variant OScriptCompiledFunction::call(OScriptInstance* p_instance, const Variant
 
     call_depth--;
 
+    if (p_state) {
+        // The resumed stack's contents are destroyed, so the buffer can serve this function's next await.
+        // This must happen before `completed` is emitted, as a listener may free the script and this function.
+        _release_state_stack(p_state->stack);
+    }
+
     if (p_state && !awaited) {
         // This means we've finished executing a resumed function and it was not awaited again
         // Signal the next function-state to resume
@@ -18,6 +18,7 @@
 
 #define ORCHESTRATOR_SCRIPT_EXTENSION           "os"
 #define ORCHESTRATOR_SCRIPT_TEXT_EXTENSION      "torch"
+#define ORCHESTRATOR_SCRIPT_IMAGE_EXTENSION     "osc"
 #define ORCHESTRATOR_SCRIPT_TYPE                "OScript"
 
 #define ORCHESTRATOR_SCRIPT_QUALIFY_EXTENSION(x) "." x
@@ -24,6 +24,7 @@
 
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/mutex.hpp>
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/packed_scene.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
@@ -31,6 +32,7 @@
 #include <godot_cpp/classes/window.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 
 // These methods assume (p_num + p_den) doesn't overflow.
 _ALWAYS_INLINE_ int32_t division_round_up(int32_t p_num, int32_t p_den) {
@@ -94,6 +96,28 @@ _ALWAYS_INLINE_ uint64_t division_round_up(uint64_t p_num, uint64_t p_den) {
 
 #define RTR(x) x
 
+/// Instances of a scene kept for reuse by an <code>OScriptNodeInstantiateScene</code> that has a pool size. Instances
+/// only return to their pool when released with <code>release_scene_instance</code>, which hands ownership back.
+struct OScriptScenePool {
+    int size = 0;
+    LocalVector<uint64_t> available; // Instance ids
+};
+
+/// A scene loaded by an <code>OScriptNodeInstantiateScene</code> with a constant path, loaded when the node is first
+/// traversed rather than when the script compiles, so a scene can spawn instances of itself. The scene is referenced
+/// weakly, so the cache doesn't keep it loaded, and once it has been freed the next call loads it again.
+struct OScriptSceneCache {
+    String path;
+    uint64_t scene_id = 0;
+};
+
+static HashMap<StringName, OScriptScenePool> scene_pools;
+static HashMap<StringName, OScriptSceneCache> scene_cache;
+static Ref<Mutex> scene_pools_lock;
+
+// Metadata that records the pool a scene instance was created for
+static const char* SCENE_POOL_META = "_oscript_scene_pool";
+
 struct OScriptUtilityFunctionsDefinitions
 {
     /// Checks whether the specified file path exists, handling <code>remap</code> export file names.
@@ -193,6 +217,36 @@ struct OScriptUtilityFunctionsDefinitions
         *r_ret = ret;
     }
 
+    /// Releases a scene instance that is no longer needed, removing it from its parent. Instances created by an
+    /// <code>OScriptNodeInstantiateScene</code> with a pool size return to that pool for reuse, others are freed.
+    static void release_scene_instance(Variant* r_ret, const Variant** p_args, int p_arg_count, GDExtensionCallError& r_error) {
+        DEBUG_VALIDATE_ARG_COUNT(1, 1);
+        DEBUG_VALIDATE_ARG_TYPE(0, Variant::OBJECT);
+
+        *r_ret = Variant();
+
+        Node* node = Object::cast_to<Node>(*p_args[0]);
+        if (!node || node->is_queued_for_deletion()) {
+            return;
+        }
+
+        if (Node* parent = node->get_parent()) {
+            parent->remove_child(node);
+        }
+
+        const StringName site = node->get_meta(SCENE_POOL_META, StringName());
+        if (!site.is_empty()) {
+            MutexLock lock(*scene_pools_lock.ptr());
+            OScriptScenePool* pool = scene_pools.getptr(site);
+            if (pool && pool->available.size() < static_cast<uint32_t>(pool->size) && !pool->available.has(node->get_instance_id())) {
+                pool->available.push_back(node->get_instance_id());
+                return;
+            }
+        }
+
+        node->queue_free();
+    }
+
     /// Returns the length of the specified Variant input argument.
     static void len(Variant* r_ret, const Variant** p_args, int p_arg_count, GDExtensionCallError& r_error) {
         DEBUG_VALIDATE_ARG_COUNT(1, 1);
@@ -284,7 +338,8 @@ struct OScriptUtilityFunctionsDefinitions
     /// like GDScript, all the information is available. But for now, this simplified the transition to AST.
 
     /// This is OScript's implementation of the <code>range</code> keyword, that allows for iterating over a
-    /// value list. This is primarily used by the <code>ForEach</code> and <code>ForLoop</code> nodes.
+    /// value list. This is primarily used by the <code>ForEach</code> and <code>ForLoop</code> nodes, although when
+    /// used as the list of a for loop, the compiler emits range iteration opcodes and this is never called.
     static void _oscript_internal_range(Variant* r_ret, const Variant** p_args, int p_arg_count, GDExtensionCallError& r_error) {
 		DEBUG_VALIDATE_ARG_COUNT(1, 3);
 		switch (p_arg_count) {
@@ -385,16 +440,87 @@ struct OScriptUtilityFunctionsDefinitions
 		}
 	}
 
-    /// A call used by te <code>OScriptNodeInstantiateScene</code> class to load the specified scene from disk, and
-    /// if successful, instantiates an instance of it and returns the instance to the caller.
+    /// Takes an instance from a scene pool that is no longer used, if there is one.
+    /// This function is intentionally not exposed to the API.
+    static Node* _take_pooled_scene(const StringName& p_pool, int p_pool_size) {
+        MutexLock lock(*scene_pools_lock.ptr());
+
+        OScriptScenePool& pool = scene_pools[p_pool];
+        pool.size = p_pool_size;
+
+        while (!pool.available.is_empty()) {
+            const uint64_t id = pool.available[pool.available.size() - 1];
+            pool.available.remove_at(pool.available.size() - 1);
+
+            // Released instances are owned by the pool, but may still have been freed by the engine
+            Node* node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+            if (node && !node->is_queued_for_deletion() && !node->is_inside_tree() && !node->get_parent()) {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Loads the scene for a call site, reusing the scene loaded by a previous call from the same site.
+    /// This function is intentionally not exposed to the API.
+    static Ref<PackedScene> _load_cached_scene(const StringName& p_site, const String& p_path) {
+        if (p_site.is_empty()) {
+            return ResourceLoader::get_singleton()->load(p_path);
+        }
+
+        {
+            MutexLock lock(*scene_pools_lock.ptr());
+            const OScriptSceneCache* cache = scene_cache.getptr(p_site);
+            if (cache && cache->path == p_path) {
+                // Only yields a reference when the scene is not already being freed
+                const Ref<PackedScene> scene(Object::cast_to<PackedScene>(ObjectDB::get_instance(cache->scene_id)));
+                if (scene.is_valid()) {
+                    return scene;
+                }
+            }
+        }
+
+        // Loaded outside the lock, the scene may instantiate scripts that traverse other call sites
+        const Ref<PackedScene> scene = ResourceLoader::get_singleton()->load(p_path);
+        if (scene.is_valid()) {
+            MutexLock lock(*scene_pools_lock.ptr());
+            OScriptSceneCache& cache = scene_cache[p_site];
+            cache.path = p_path;
+            cache.scene_id = scene->get_instance_id();
+        }
+        return scene;
+    }
+
+    /// A call used by the <code>OScriptNodeInstantiateScene</code> class to instantiate a scene, either from a
+    /// <code>PackedScene</code> or by loading the scene path from disk. When a call site is given, the scene loaded
+    /// by its first call is reused by later calls, and with a pool size, instances that were released with
+    /// <code>release_scene_instance</code> are reused from the site's pool.
     static void _oscript_internal_instantiate_scene(Variant* r_ret, const Variant** p_args, int p_arg_count, GDExtensionCallError& r_error) {
-        DEBUG_VALIDATE_ARG_COUNT(1, 1);
-        DEBUG_VALIDATE_ARG_TYPE(0, Variant::STRING);
+        DEBUG_VALIDATE_ARG_COUNT(1, 3);
+        DEBUG_VALIDATE_ARG_TYPE(0, Variant::NIL);
+
+        const int pool_size = p_arg_count > 1 ? static_cast<int>(*p_args[1]) : 0;
+        const StringName site = p_arg_count > 2 ? StringName(*p_args[2]) : StringName();
+        const bool pooled = pool_size > 0 && !site.is_empty();
+
+        if (pooled) {
+            if (Node* node = _take_pooled_scene(site, pool_size)) {
+                *r_ret = node;
+                return;
+            }
+        }
+
+        Ref<PackedScene> resource = *p_args[0];
+        if (resource.is_null() && p_args[0]->get_type() == Variant::STRING) {
+            resource = _load_cached_scene(site, *p_args[0]);
+        }
 
-        const Ref<PackedScene> resource = ResourceLoader::get_singleton()->load(*p_args[0]);
         if (resource.is_valid()) {
             Node* root = resource->instantiate();
             if (root) {
+                if (pooled) {
+                    root->set_meta(SCENE_POOL_META, site);
+                }
                 *r_ret = root;
                 return;
             }
@@ -602,6 +728,7 @@ static void _register_function(const StringName& p_name, const MethodInfo& p_met
 #define ARGTYPE(m_name)         PropertyInfo(Variant::INT, m_name, PROPERTY_HINT_NONE, "", PROPERTY_USAGE_CLASS_IS_ENUM, "Variant.Type")
 
 void OScriptUtilityFunctions::register_functions() {
+    scene_pools_lock.instantiate();
 
     REGISTER_FUNC(print_debug, false, RET(NIL), NOARGS, true, varray(), false);
     REGISTER_FUNC(print_stack, false, RET(NIL), NOARGS, false, varray(), false);
@@ -611,12 +738,13 @@ void OScriptUtilityFunctions::register_functions() {
     #endif
     REGISTER_FUNC(len, true, RET(INT), ARGS(ARGVAR("var")), false, varray(), false);
     REGISTER_FUNC(load, false, RETCLS("Resource"), ARGS( ARG("path", STRING) ), false, varray(), false);
+    REGISTER_FUNC(release_scene_instance, false, RET(NIL), ARGS( PropertyInfo(Variant::OBJECT, "instance", PROPERTY_HINT_NODE_TYPE, "Node", PROPERTY_USAGE_DEFAULT, "Node") ), false, varray(), false);
 
     // Internal methods
     // These are used typically by visual script nodes to make the creation of the AST easier, and
     // users should never expect these functions to exist indefinitely.
     REGISTER_FUNC(_oscript_internal_range, false, RET(ARRAY), NOARGS, true, varray(), true);
-    REGISTER_FUNC(_oscript_internal_instantiate_scene, false, PropertyInfo(Variant::OBJECT, "", PROPERTY_HINT_NODE_TYPE, "Node", PROPERTY_USAGE_DEFAULT, "Node"), ARGS( ARG("path", STRING) ), false, varray(), true);
+    REGISTER_FUNC(_oscript_internal_instantiate_scene, false, PropertyInfo(Variant::OBJECT, "", PROPERTY_HINT_NODE_TYPE, "Node", PROPERTY_USAGE_DEFAULT, "Node"), ARGS( ARGVAR("scene"), ARG("pool_size", INT), ARG("site", STRING_NAME) ), false, varray(0, StringName()), true);
     REGISTER_FUNC(_oscript_internal_print_string, false, RET(NIL), ARGS( ARG("is_tool", BOOL), ARGVAR("text"), ARG("print_to_screen", BOOL), ARG("print_to_log", BOOL), ARG("text_color", COLOR), ARG("duration", FLOAT)), false, varray(), true);
     REGISTER_FUNC(_oscript_internal_show_dialogue, false, RETCLS("Node"), ARGS( ARGVAR("parent"), ARG("scene_path", STRING), ARGVAR("options") ), false, varray(), true);
 
@@ -626,6 +754,20 @@ void OScriptUtilityFunctions::register_functions() {
 }
 
 void OScriptUtilityFunctions::unregister_functions() {
+    // Pooled instances were released by their callers, so the pool is their only owner
+    for (const KeyValue<StringName, OScriptScenePool>& E : scene_pools) {
+        for (const uint64_t id : E.value.available) {
+            if (Node* node = Object::cast_to<Node>(ObjectDB::get_instance(id))) {
+                if (!node->is_inside_tree() && !node->get_parent()) {
+                    memdelete(node);
+                }
+            }
+        }
+    }
+    scene_pools.clear();
+    scene_cache.clear();
+    scene_pools_lock.unref();
+
     utility_function_name_table.clear();
     utility_function_table.clear();
 
@@ -5,6 +5,9 @@ Downloads (or reuses) the appropriate Godot build, copies the addon into the tes
 project, imports the project, then runs every scene under scenes/ and compares its
 output against the matching .out file.
 
+Scenes whose .meta file has "optimize_bytecode: true" run a second time with the
+bytecode optimizer enabled, and must produce the same output.
+
 Usage:
     python3 run_integration_tests.py [options]
 
@@ -17,6 +20,11 @@ Options:
                           compatibility_minimum read from the .gdextension file.
     -j, --jobs N          Number of scenes to run in parallel. Defaults to the CPU
                           count, capped at 4; use -j 1 to force sequential runs.
+    --exported            Export the project to a pack first and run every scene
+                          from it, so scripts load from their exported bytecode
+                          images. A scene fails when its orchestration was
+                          exported without an image, unless its .meta file has
+                          "bytecode_image: none".
     -h, --help            Show the argparse-generated help and exit.
 
 Exit code is 0 when all tests pass (or skip), and 1 if any test fails, crashes, or
@@ -31,6 +39,7 @@ import re
 import shutil
 import subprocess
 import sys
+import tempfile
 import urllib.request
 
 from concurrent.futures import ThreadPoolExecutor
@@ -40,6 +49,18 @@ MAX_JOBS = 4
 
 scenes_dir = (Path(__file__).parent / "scenes").resolve()
 
+# Name of the preset in export_presets.cfg used by --exported
+EXPORT_PRESET = "Tests"
+IMAGE_SKIPPED = re.compile(r"Orchestration '([^']+)' is exported without a bytecode image.*?: (.*)")
+
+# Set by --exported, the exported pack and the orchestrations exported without an image
+main_pack = None
+images_skipped = {}
+
+# Enables the bytecode optimizer for the test project while it exists
+OVERRIDE_FILE = Path(__file__).parent / "override.cfg"
+optimized_run = False
+
 use_color = sys.stdout.isatty()
 GREEN  = "\033[32m"
 RED    = "\033[31m"
@@ -62,7 +83,8 @@ def color(text, c):
 def format_result(status, elapsed, scene_file):
     label = color(f"{status:<6}", STATUS_COLORS[status])
     rel = scene_file.resolve().relative_to(scenes_dir)
-    return f"{label}  ({elapsed:.2f}s)  {rel}"
+    suffix = " [optimized]" if optimized_run else ""
+    return f"{label}  ({elapsed:.2f}s)  {rel}{suffix}"
 
 def summary_part(n, label, c):
     text = f"{n} {label}"
@@ -90,17 +112,19 @@ def truncate(text, max_lines=30):
 def parse_version(v):
     return tuple(int(x) for x in v.split(".")[:2])
 
-def is_version_supported(version, scene_file):
+def read_meta(scene_file):
     meta_file = scene_file.with_suffix(".meta")
-    if not meta_file.exists():
-        # If no meta exists, the test is acceptable to run on all versions
-        return True
-
     meta = {}
-    for line in meta_file.read_text().splitlines():
-        if ":" in line:
-            key, value = line.split(":", 1)
-            meta[key.strip()] = value.strip()
+    if meta_file.exists():
+        for line in meta_file.read_text().splitlines():
+            if ":" in line:
+                key, value = line.split(":", 1)
+                meta[key.strip()] = value.strip()
+    return meta
+
+def is_version_supported(version, scene_file):
+    # If no meta exists, the test is acceptable to run on all versions
+    meta = read_meta(scene_file)
 
     current = parse_version(version)
     if "min_version" in meta and current < parse_version(meta["min_version"]):
@@ -181,16 +205,55 @@ def import_project():
         stdout=subprocess.DEVNULL,
         stderr=subprocess.DEVNULL)
 
+def export_pack(export_dir):
+    pack = Path(export_dir) / "tests.pck"
+    result = subprocess.run(
+        [
+            godot_path,
+            "--no-header",
+            "--headless",
+            "--path",
+            Path(__file__).parent,
+            "--export-pack",
+            EXPORT_PRESET,
+            str(pack)],
+        capture_output=True,
+        text=True)
+
+    if result.returncode != 0 or not pack.exists():
+        print(f"Exporting the test project failed with exit code {result.returncode}")
+        print(truncate((result.stdout + result.stderr).strip()))
+        sys.exit(1)
+
+    skipped = {}
+    for line in (result.stdout + result.stderr).splitlines():
+        match = IMAGE_SKIPPED.search(line)
+        if match:
+            skipped[match.group(1)] = match.group(2)
+    return pack, skipped
+
+def get_image_skipped_reason(scene_file):
+    # Scenes run their orchestration of the same name
+    torch_file = scene_file.resolve().with_suffix(".torch")
+    res_path = "res://" + torch_file.relative_to(Path(__file__).parent.resolve()).as_posix()
+    if read_meta(scene_file).get("bytecode_image") == "none":
+        return None
+    return images_skipped.get(res_path)
+
 def run_scene(scene_file):
     start = time.monotonic()
+
+    command = [godot_path, "--no-header", "--headless", "--path", Path(__file__).parent]
+    if main_pack:
+        reason = get_image_skipped_reason(scene_file)
+        if reason:
+            return "FAIL", format_result("FAIL", 0, scene_file) + \
+                f"\n  The orchestration was exported without a bytecode image: {reason}"
+        command += ["--main-pack", str(main_pack)]
+
     try:
         result = subprocess.run(
-            [
-                godot_path,
-                "--no-header",
-                "--headless",
-                "--path",
-                Path(__file__).parent,
+            command + [
                 "--quit-after",
                 "2",
                 "--scene",
@@ -211,7 +274,17 @@ def run_scene(scene_file):
     elapsed = time.monotonic() - start
     return validate_output(scene_file, result, elapsed)
 
+def run_scenes(scenes, jobs):
+    with ThreadPoolExecutor(max_workers=jobs) as executor:
+        # map() preserves submission order, so output stays deterministic
+        # regardless of which scene finishes first.
+        for status, text in executor.map(run_scene, scenes):
+            counts[status] += 1
+            print(text)
+
 def test_scenes(version, name_filter, jobs):
+    global optimized_run
+
     scenes = []
     for scene_file in sorted(scenes_dir.rglob("*.tscn")):
         rel = scene_file.relative_to(scenes_dir)
@@ -221,12 +294,18 @@ def test_scenes(version, name_filter, jobs):
             continue
         scenes.append(scene_file)
 
-    with ThreadPoolExecutor(max_workers=jobs) as executor:
-        # map() preserves submission order, so output stays deterministic
-        # regardless of which scene finishes first.
-        for status, text in executor.map(run_scene, scenes):
-            counts[status] += 1
-            print(text)
+    run_scenes(scenes, jobs)
+
+    # Exported scripts load the bytecode compiled at export, so the optimizer setting has no effect
+    optimized = [s for s in scenes if read_meta(s.resolve()).get("optimize_bytecode") == "true"]
+    if optimized and not main_pack:
+        OVERRIDE_FILE.write_text("[orchestrator]\n\ndebug/settings/optimize_bytecode=true\n")
+        optimized_run = True
+        try:
+            run_scenes(optimized, jobs)
+        finally:
+            optimized_run = False
+            OVERRIDE_FILE.unlink(missing_ok=True)
 
 def atomic_copy(src, dst):
     src = Path(src)
@@ -314,6 +393,9 @@ def parse_args():
     parser.add_argument(
         "--no-color", action="store_true",
         help="Disable colored output.")
+    parser.add_argument(
+        "--exported", action="store_true",
+        help="Run the scenes from an exported pack, loading scripts from bytecode images.")
     parser.add_argument(
         "--version", dest="version", default=None,
         help="Godot version to test against (overrides the .gdextension minimum).")
@@ -325,7 +407,7 @@ def parse_args():
     return parser.parse_args()
 
 def main():
-    global version, godot_path, use_color
+    global version, godot_path, use_color, main_pack, images_skipped
 
     args = parse_args()
     use_color = sys.stdout.isatty() and not args.no_color
@@ -340,7 +422,10 @@ def main():
     jobs = max(1, min(args.jobs, MAX_JOBS))
 
     run_start = time.monotonic()
-    test_scenes(version, args.filter, jobs)
+    with tempfile.TemporaryDirectory(prefix="orchestrator-tests-") as export_dir:
+        if args.exported:
+            main_pack, images_skipped = export_pack(export_dir)
+        test_scenes(version, args.filter, jobs)
     total_elapsed = time.monotonic() - run_start
 
     print_summary(total_elapsed)